@@ -0,0 +1,57 @@
+# ----------------------------------------------------------------------------------------
+#                     SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Resampling of macro-particles (resampling_ppc) in a thermal plasma.
+# The plasma starts with 4 particles per cell, which are split towards the target
+# of 32 particles per cell. The fields are frozen, so that the particles move freely:
+# the total charge and the kinetic energy of the species must be conserved.
+
+import math
+
+Te   = 10./511.          # electron temperature (10 keV)
+dx   = 0.1               # spatial resolution
+Lsim = 256*dx            # simulation length
+dt   = 0.95*dx           # timestep
+tsim = 100*dt            # duration of the simulation
+
+Main(
+    geometry = "1d3v",
+    
+    interpolation_order = 2,
+    
+    timestep = dt,
+    sim_time = tsim,
+    
+    cell_length = [dx],
+    sim_length  = [Lsim],
+    
+    number_of_patches = [ 8 ],
+    
+    bc_em_type_x = ['periodic'],
+    
+    solve_poisson = False,
+    time_fields_frozen = 2*tsim,
+    
+    random_seed = 0
+)
+
+Species(
+    species_type = 'eon',
+    initPosition_type = 'random',
+    initMomentum_type = 'maxwell-juettner',
+    n_part_per_cell = 4,
+    mass = 1.0,
+    charge = -1.0,
+    nb_density = 1.,
+    temperature = [Te],
+    bc_part_type_xmin = 'none',
+    bc_part_type_xmax = 'none',
+    resampling_ppc = 32,
+    resampling_every = 10
+)
+
+DiagScalar(
+    every = 10,
+    vars = ['Ntot_eon', 'Dens_eon', 'Ukin_eon']
+)
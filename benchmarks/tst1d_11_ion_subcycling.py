@@ -0,0 +1,90 @@
+# ----------------------------------------------------------------------------------------
+#                     SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Thermal expansion of a plasma slab, with two identical species of test ions: one moved
+# at each timestep, the other one subcycled (moved every 4 timesteps). Both see the same
+# fields, so that their trajectories must agree within the first-order approximation
+# of the subcycling.
+
+import math
+
+Te_keV = 1.              # electron temperature in keV
+Te  = Te_keV/511.        # Te normalised in mec^2 (code units)
+vth = math.sqrt(Te)      # normalised thermal velocity
+Ld    = vth              # Debye length in normalised units
+dx  = Ld/2.              # spatial resolution
+Lsim = 40.*Ld            # simulation length
+tsim = 20.               # duration of the simulation
+
+mi = 100.0               # ion mass (use reduced one to accelerate computation)
+
+subcycle = 4
+dt = 0.2*dx              # subcycle*dt must be smaller than dx
+
+Main(
+    geometry = "1d3v",
+    
+    interpolation_order = 2,
+    
+    timestep = dt,
+    sim_time = tsim,
+    
+    cell_length = [dx],
+    sim_length  = [Lsim],
+    
+    number_of_patches = [ 8 ],
+    
+    bc_em_type_x = ['silver-muller','silver-muller'] ,
+    
+    random_seed = 0
+)
+
+Species(
+    species_type = 'ion',
+    initPosition_type = 'regular',
+    initMomentum_type = 'mj',
+    n_part_per_cell = 10,
+    mass = mi, 
+    charge = 1.0,
+    nb_density = trapezoidal(1., xplateau=20.*Ld),
+    temperature = [1.e-6],
+    thermT = [1.e-6],
+    thermVelocity = [0.,0.,0.],
+    bc_part_type_xmin = 'thermalize',
+    bc_part_type_xmax = 'refl'
+)
+Species(
+    species_type = 'eon',
+    initPosition_type = 'regular',
+    initMomentum_type = 'maxwell-juettner',
+    n_part_per_cell = 100,
+    mass = 1.0,
+    charge = -1.0,
+    nb_density = trapezoidal(1., xplateau=20.*Ld),
+    temperature = [Te],
+    thermT = [Te],
+    thermVelocity = [0.,0.,0.],
+    bc_part_type_xmin = 'thermalize',
+    bc_part_type_xmax = 'refl'
+)
+
+# The subcycled ions are moved at the timesteps 0, 4, 8, ... by 4 timesteps at once:
+# both species are at the same time at the end of the timesteps 3, 7, 11, ...
+for name, n in [("ion_ref", 1), ("ion_sub", subcycle)]:
+    Species(
+        species_type = name,
+        initPosition_type = 'regular',
+        initMomentum_type = 'cold',
+        n_part_per_cell = 4,
+        mass = mi,
+        charge = 1.0,
+        nb_density = trapezoidal(1., xplateau=20.*Ld),
+        bc_part_type_xmin = 'refl',
+        bc_part_type_xmax = 'refl',
+        subcycle = n,
+        track_every = [subcycle-1, 100*subcycle],
+        isTest = True
+    )
+
+DiagScalar(every = 100*subcycle)
@@ -0,0 +1,59 @@
+# ----------------------------------------------------------------------------------------
+#                     SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Merging of macro-particles (merging_method = "vranic") in a thermal plasma.
+# The fields are frozen, so that the particles move freely: the total charge and the
+# kinetic energy of the species must be conserved by the merging, while the number of
+# macro-particles decreases.
+
+import math
+
+Te   = 10./511.          # electron temperature (10 keV)
+dx   = 0.1               # spatial resolution
+Lsim = 256*dx            # simulation length
+dt   = 0.95*dx           # timestep
+tsim = 200*dt            # duration of the simulation
+
+Main(
+    geometry = "1d3v",
+    
+    interpolation_order = 2,
+    
+    timestep = dt,
+    sim_time = tsim,
+    
+    cell_length = [dx],
+    sim_length  = [Lsim],
+    
+    number_of_patches = [ 8 ],
+    
+    bc_em_type_x = ['periodic'],
+    
+    solve_poisson = False,
+    time_fields_frozen = 2*tsim,
+    
+    random_seed = 0
+)
+
+Species(
+    species_type = 'eon',
+    initPosition_type = 'random',
+    initMomentum_type = 'maxwell-juettner',
+    n_part_per_cell = 128,
+    mass = 1.0,
+    charge = -1.0,
+    nb_density = 1.,
+    temperature = [Te],
+    bc_part_type_xmin = 'none',
+    bc_part_type_xmax = 'none',
+    merging_method = 'vranic',
+    merge_every = 50,
+    merge_min_particles_per_cell = 8,
+    merge_momentum_cells = [2, 2, 2]
+)
+
+DiagScalar(
+    every = 10,
+    vars = ['Ntot_eon', 'Dens_eon', 'Ukin_eon']
+)
@@ -0,0 +1,79 @@
+# ----------------------------------------------------------------------------------------
+#                     SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Two-stream instability in 2D, where each beam is split in identical species sorted
+# with different sort_mode. All the species see the same fields, so that their
+# evolution must be the same as that of the species sorted with the default mode "bin".
+
+import math
+L  = 1.12            # wavelength = simulation box length
+dn = 0.001           # amplitude of the perturbation
+
+# Name and sorting parameters of the copies of each beam
+sorts = [
+    ("bin" , dict(sort_mode = "bin" )),
+    ("cell", dict(sort_mode = "cell")),
+    ("cell_threshold", dict(sort_mode = "cell", sort_threshold = 0.1)),
+    ("morton", dict(sort_mode = "morton")),
+]
+
+Main(
+    geometry = "2d3v",
+    
+    interpolation_order = 2,
+    
+    cell_length = [0.02, 0.02],
+    sim_length  = [L, L],
+    
+    number_of_patches = [ 4, 4 ],
+    
+    timestep = 0.01,
+    sim_time = 20.,
+    
+    bc_em_type_x = ['periodic'],
+    bc_em_type_y = ['periodic'],
+    
+    random_seed = 0
+)
+
+Species(
+    species_type = "ion",
+    initPosition_type = "regular",
+    initMomentum_type = "cold",
+    n_part_per_cell = 4,
+    mass = 1836.0,
+    charge = 1.0,
+    nb_density = 1.,
+    time_frozen = 10000.,
+    bc_part_type_xmin = "none",
+    bc_part_type_xmax = "none",
+    bc_part_type_ymin = "none",
+    bc_part_type_ymax = "none"
+)
+
+density = lambda x,y: 0.5/len(sorts) * (1. + dn*math.cos(2.*math.pi*x/L) + dn*math.cos(2.*math.pi*y/L))
+
+for name, sort in sorts:
+    for beam, v in [("eon1", -0.1), ("eon2", 0.1)]:
+        Species(
+            species_type = beam+"_"+name,
+            initPosition_type = "regular",
+            initMomentum_type = "cold",
+            n_part_per_cell = 4,
+            mass = 1.0,
+            charge = -1.0,
+            nb_density = density,
+            mean_velocity = [v, 0.5*v, 0.0],
+            bc_part_type_xmin = "none",
+            bc_part_type_xmax = "none",
+            bc_part_type_ymin = "none",
+            bc_part_type_ymax = "none",
+            **sort
+        )
+
+DiagScalar(
+    every = 100,
+    vars = ["Ntot_"+beam+"_"+name for name, sort in sorts for beam in ["eon1","eon2"]]
+         + ["Ukin_"+beam+"_"+name for name, sort in sorts for beam in ["eon1","eon2"]]
+)
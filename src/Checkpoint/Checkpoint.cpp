@@ -325,20 +325,20 @@ void Checkpoint::dumpPatch( ElectroMagn* EMfields, std::vector<Species*> vecSpec
             for (unsigned int i=0; i<vecSpecies[ispec]->particles->Position.size(); i++) {
                 ostringstream my_name("");
                 my_name << "Position-" << i;
-                H5::vect(gid,my_name.str(), vecSpecies[ispec]->particles->Position[i], dump_deflate);
+                dumpRealProperty(gid, my_name.str(), vecSpecies[ispec]->particles->Position[i], vecSpecies[ispec]->particles->size());
             }
             
             for (unsigned int i=0; i<vecSpecies[ispec]->particles->Momentum.size(); i++) {
                 ostringstream my_name("");
                 my_name << "Momentum-" << i;
-                H5::vect(gid,my_name.str(), vecSpecies[ispec]->particles->Momentum[i], dump_deflate);
+                dumpRealProperty(gid, my_name.str(), vecSpecies[ispec]->particles->Momentum[i], vecSpecies[ispec]->particles->size());
             }
             
-            H5::vect(gid,"Weight", vecSpecies[ispec]->particles->Weight, dump_deflate);
-            H5::vect(gid,"Charge", vecSpecies[ispec]->particles->Charge, dump_deflate);
+            dumpRealProperty(gid, "Weight", vecSpecies[ispec]->particles->Weight, vecSpecies[ispec]->particles->size());
+            H5::vect(gid,"Charge", vecSpecies[ispec]->particles->Charge[0], vecSpecies[ispec]->particles->size(), H5T_NATIVE_SHORT, dump_deflate);
             
             if (vecSpecies[ispec]->particles->tracked) {
-                H5::vect(gid,"Id", vecSpecies[ispec]->particles->Id, H5T_NATIVE_UINT64, dump_deflate);
+                H5::vect(gid,"Id", vecSpecies[ispec]->particles->Id[0], vecSpecies[ispec]->particles->size(), H5T_NATIVE_UINT64, dump_deflate);
             }
             
             
@@ -456,6 +456,10 @@ void Checkpoint::restartAll( VectorPatch &vecPatches,  SmileiMPI* smpi, SimWindo
     
     H5Fclose( fid );
     
+    // The particles were reallocated by the master thread while loading the patches : move them again to the threads
+    // in charge of their patches (createVector placed the patches before they were loaded)
+    vecPatches.firstTouch( smpi );
+    
 }
 
 
@@ -565,21 +569,21 @@ void Checkpoint::restartPatch( ElectroMagn* EMfields,std::vector<Species*> &vecS
             for (unsigned int i=0; i<vecSpecies[ispec]->particles->Position.size(); i++) {
                 ostringstream namePos("");
                 namePos << "Position-" << i;
-                H5::getVect(gid,namePos.str(),vecSpecies[ispec]->particles->Position[i]);
+                restartRealProperty(gid, namePos.str(), vecSpecies[ispec]->particles->Position[i], partSize);
             }
             
             for (unsigned int i=0; i<vecSpecies[ispec]->particles->Momentum.size(); i++) {
                 ostringstream namePos("");
                 namePos << "Momentum-" << i;
-                H5::getVect(gid,namePos.str(),vecSpecies[ispec]->particles->Momentum[i]);
+                restartRealProperty(gid, namePos.str(), vecSpecies[ispec]->particles->Momentum[i], partSize);
             }
             
-            H5::getVect(gid,"Weight",vecSpecies[ispec]->particles->Weight);
+            restartRealProperty(gid, "Weight", vecSpecies[ispec]->particles->Weight, partSize);
             
-            H5::getVect(gid,"Charge",vecSpecies[ispec]->particles->Charge);
+            H5::getArray(gid,"Charge",vecSpecies[ispec]->particles->Charge.data(), partSize, H5T_NATIVE_SHORT);
             
             if (vecSpecies[ispec]->particles->tracked) {
-                H5::getVect(gid,"Id",vecSpecies[ispec]->particles->Id, H5T_NATIVE_UINT64);
+                H5::getArray(gid,"Id",vecSpecies[ispec]->particles->Id.data(), partSize, H5T_NATIVE_UINT64);
             }
             
             H5::getVect(gid,"bmin",vecSpecies[ispec]->bmin,true);
@@ -592,6 +596,24 @@ void Checkpoint::restartPatch( ElectroMagn* EMfields,std::vector<Species*> &vecS
     
 }
 
+// Real particle properties are written as stored (double, or float for precision="single")
+void Checkpoint::dumpRealProperty(hid_t gid, string name, ParticleRealProperty& prop, unsigned int size)
+{
+    if (prop.single)
+        H5::vect(gid, name, prop.f[0], size, H5T_NATIVE_FLOAT, dump_deflate);
+    else
+        H5::vect(gid, name, prop.d[0], size, H5T_NATIVE_DOUBLE, dump_deflate);
+}
+
+// HDF5 converts the data if the checkpoint was written with another precision
+void Checkpoint::restartRealProperty(hid_t gid, string name, ParticleRealProperty& prop, unsigned int size)
+{
+    if (prop.single)
+        H5::getArray(gid, name, prop.f.data(), size, H5T_NATIVE_FLOAT);
+    else
+        H5::getArray(gid, name, prop.d.data(), size, H5T_NATIVE_DOUBLE);
+}
+
 void Checkpoint::dumpFieldsPerProc(hid_t fid, Field* field)
 {
     hsize_t dims[1]={field->globalDims_};
@@ -21,6 +21,7 @@ class SimWindow;
 class ElectroMagn;
 class Field;
 class Species;
+class ParticleRealProperty;
 class VectorPatch;
 
 #include <csignal>
@@ -94,6 +95,12 @@ private:
     //! dump moving window parameters
     void dumpMovingWindow(hid_t fid, SimWindow* simWindow);
     
+    //! dump a real particle property in its storage precision
+    void dumpRealProperty(hid_t gid, std::string name, ParticleRealProperty& prop, unsigned int size);
+    
+    //! restart a real particle property in its storage precision
+    void restartRealProperty(hid_t gid, std::string name, ParticleRealProperty& prop, unsigned int size);
+    
     //! function that returns elapsed time from creator (uses private var time_reference)
     //double time_seconds();
     
@@ -19,15 +19,18 @@ const double CollisionalIonization::a1 = 510998.9 ; // = me*c^2/Emin
 const double CollisionalIonization::a2 = 6.142165 ; // = (npoints-1) / ln( Emax/Emin )
 
 // Constructor
-CollisionalIonization::CollisionalIonization(int Z, int nDim_, double referenceAngularFrequency_SI, bool tracked_electrons)
+CollisionalIonization::CollisionalIonization(int Z, int nDim_, double referenceAngularFrequency_SI, Particles* electrons)
 {
     nDim = nDim_;
     atomic_number = Z;
     rate .resize(Z);
     irate.resize(Z);
     prob .resize(Z);
-    new_electrons.tracked = tracked_electrons;
-    new_electrons.initialize(0, nDim); // to be removed if bins removed
+    // new electrons are stored like the electrons
+    if( electrons )
+        new_electrons.initialize(0, *electrons);
+    else
+        new_electrons.initialize(0, nDim); // to be removed if bins removed
     
     if( Z>0 ) {
         dataBaseIndex = createDatabase(referenceAngularFrequency_SI);
@@ -44,8 +47,7 @@ CollisionalIonization::CollisionalIonization(CollisionalIonization* CI)
     rate .resize(atomic_number);
     irate.resize(atomic_number);
     prob .resize(atomic_number);
-    new_electrons.tracked = CI->new_electrons.tracked;
-    new_electrons.initialize(0, nDim); // to be removed if bins removed
+    new_electrons.initialize(0, CI->new_electrons); // to be removed if bins removed
     
     assignDatabase(CI->dataBaseIndex);
 
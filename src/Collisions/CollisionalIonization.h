@@ -15,7 +15,7 @@ class CollisionalIonization
 
 public:
     //! Constructor
-    CollisionalIonization(int, int, double, bool);
+    CollisionalIonization(int, int, double, Particles*);
     //! Cloning Constructor
     CollisionalIonization(CollisionalIonization*);
     //! Destructor
@@ -101,7 +101,7 @@ private:
 class CollisionalNoIonization : public CollisionalIonization
 {
 public:
-    CollisionalNoIonization() : CollisionalIonization(0,0,0.,false) {};
+    CollisionalNoIonization() : CollisionalIonization(0,0,0.,NULL) {};
     ~CollisionalNoIonization(){};
     
     unsigned int createDatabase(double) override { return 0; };
@@ -40,6 +40,10 @@ public :
     
     //! Tells whether this diagnostic requires the pre-calculation of the particle J & Rho
     virtual bool needsRhoJs(int timestep) { return false; };
+    
+    //! Flags the fields of ElectroMagn::allFields that this diagnostic requires at this timestep
+    //! (only the flagged species densities are deposited, see ElectroMagn::selectRhoJs)
+    virtual void flagRhoJs(int, std::vector<bool>&) {};
 
     //! Time selection for writing the diagnostic
     TimeSelection * timeSelection;
@@ -287,5 +287,12 @@ void DiagnosticFields::run( SmileiMPI* smpi, VectorPatch& vecPatches, int itime,
 }
 
 bool DiagnosticFields::needsRhoJs(int itime) {
-    return hasRhoJs && timeSelection->theTimeIsNow(itime);
+    // When time-averaging, the densities are required at all the iterations of the average
+    return hasRhoJs && prepare(itime);
+}
+
+void DiagnosticFields::flagRhoJs(int itime, vector<bool>& fields_needed) {
+    if( needsRhoJs(itime) )
+        for( unsigned int ifield=0; ifield<fields_indexes.size(); ifield++ )
+            fields_needed[fields_indexes[ifield]] = true;
 }
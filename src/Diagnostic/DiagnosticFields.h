@@ -26,6 +26,8 @@ public :
     
     virtual bool needsRhoJs(int itime) override;
     
+    virtual void flagRhoJs(int itime, std::vector<bool>& fields_needed) override;
+    
     bool hasField(std::string field_name, std::vector<std::string> fieldsToDump);
 
     //! Get memory footprint of current diagnostic
@@ -13,6 +13,25 @@
 
 using namespace std;
 
+#ifdef SMILEI_USE_NUMPY
+// Expose a real particle property as a numpy array of doubles (a copy if it is stored in single precision)
+static PyArrayObject* realPropertyArray( ParticleRealProperty& prop, npy_intp* dims )
+{
+    if( ! prop.single )
+        return (PyArrayObject*)PyArray_SimpleNewFromData(1, dims, NPY_DOUBLE, (double*)(prop.data<double>()));
+    
+    PyArrayObject* array = (PyArrayObject*)PyArray_SimpleNew(1, dims, NPY_DOUBLE);
+    double* data = (double*)PyArray_DATA(array);
+    for( npy_intp i=0; i<dims[0]; i++ )
+        data[i] = prop.f[i];
+    return array;
+}
+#endif
+
+// Type of the particle property which fills a buffer of type T (doubles come from real properties)
+template<typename T> struct TrackedProperty { typedef ParticleProperty<T> type; };
+template<> struct TrackedProperty<double> { typedef ParticleRealProperty type; };
+
 DiagnosticTrack::DiagnosticTrack( Params &params, SmileiMPI* smpi, Patch* patch, unsigned int speciesId, OpenPMDparams& oPMD ) :
     Diagnostic(oPMD),
     IDs_done( params.restart ),
@@ -170,11 +189,11 @@ void DiagnosticTrack::run( SmileiMPI* smpi, VectorPatch& vecPatches, int itime,
     
         // Obtain the particle partition of all the patches in this MPI
         patch_start.resize( vecPatches.size() );
+        patch_selection.resize( vecPatches.size() );
         
         if( has_filter ) {
         
 #ifdef SMILEI_USE_NUMPY
-            patch_selection.resize( vecPatches.size() );
             PyArrayObject *x,*y,*z,*px,*py,*pz,*ret;
             npy_intp dims[1];
             for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
@@ -182,14 +201,14 @@ void DiagnosticTrack::run( SmileiMPI* smpi, VectorPatch& vecPatches, int itime,
                 Particles * p = vecPatches(ipatch)->vecSpecies[speciesId_]->particles;
                 unsigned int npart = p->size();
                 dims[0] = (npy_intp) npart;
-                px = (PyArrayObject*)PyArray_SimpleNewFromData(1, dims, NPY_DOUBLE, (double*)(p->Momentum[0].data()));
-                py = (PyArrayObject*)PyArray_SimpleNewFromData(1, dims, NPY_DOUBLE, (double*)(p->Momentum[1].data()));
-                pz = (PyArrayObject*)PyArray_SimpleNewFromData(1, dims, NPY_DOUBLE, (double*)(p->Momentum[2].data()));
-                x  = (PyArrayObject*)PyArray_SimpleNewFromData(1, dims, NPY_DOUBLE, (double*)(p->Position[0].data()));
+                px = realPropertyArray(p->Momentum[0], dims);
+                py = realPropertyArray(p->Momentum[1], dims);
+                pz = realPropertyArray(p->Momentum[2], dims);
+                x  = realPropertyArray(p->Position[0], dims);
                 if( nDim_particle>1 ) {
-                    y = (PyArrayObject*)PyArray_SimpleNewFromData(1, dims, NPY_DOUBLE, (double*)(p->Position[1].data()));
+                    y = realPropertyArray(p->Position[1], dims);
                     if( nDim_particle>2 ) {
-                        z = (PyArrayObject*)PyArray_SimpleNewFromData(1, dims, NPY_DOUBLE, (double*)(p->Position[2].data()));
+                        z = realPropertyArray(p->Position[2], dims);
                         ret = (PyArrayObject*)PyObject_CallFunctionObjArgs(filter, x,y,z,px,py,pz, NULL);
                         Py_DECREF(z);
                     } else {
@@ -225,8 +244,12 @@ void DiagnosticTrack::run( SmileiMPI* smpi, VectorPatch& vecPatches, int itime,
             
         } else {
             for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
+                unsigned int npart = vecPatches(ipatch)->vecSpecies[speciesId_]->getNbrOfParticles();
+                patch_selection[ipatch].resize( npart );
+                for(unsigned int i=0; i<npart; i++)
+                    patch_selection[ipatch][i] = i;
                 patch_start[ipatch] = nParticles_local;
-                nParticles_local += vecPatches(ipatch)->vecSpecies[speciesId_]->getNbrOfParticles();
+                nParticles_local += npart;
             }
         }
         
@@ -309,6 +332,12 @@ void DiagnosticTrack::run( SmileiMPI* smpi, VectorPatch& vecPatches, int itime,
         H5Sclose( memspace );
     }
     
+    // Order the selection of each patch by Id : this permutation is applied to all the properties by fill_buffer
+    #pragma omp barrier
+    #pragma omp for schedule(runtime)
+    for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++)
+        vecPatches(ipatch)->vecSpecies[speciesId_]->particles->radixSortById( patch_selection[ipatch] );
+    
     // Id
     #pragma omp master
     data_uint64.resize( nParticles_local, 1 );
@@ -431,31 +460,17 @@ template<typename T>
 void DiagnosticTrack::fill_buffer(VectorPatch& vecPatches, unsigned int iprop, vector<T>& buffer)
 {
     unsigned int patch_nParticles, i, j, nPatches=vecPatches.size();
-    vector<T>* property = NULL;
+    typename TrackedProperty<T>::type* property = NULL;
     
-    if( has_filter ) {
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++) {
-            patch_nParticles = patch_selection[ipatch].size();
-            vecPatches(ipatch)->vecSpecies[speciesId_]->particles->getProperty(iprop, property);
-            i=0;
-            j=patch_start[ipatch];
-            while( i<patch_nParticles ) {
-                buffer[j] = (*property)[patch_selection[ipatch][i]];
-                i++; j++;
-            }
-        }
-    } else {
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++) {
-            patch_nParticles = vecPatches(ipatch)->vecSpecies[speciesId_]->particles->size();
-            vecPatches(ipatch)->vecSpecies[speciesId_]->particles->getProperty(iprop, property);
-            i=0;
-            j=patch_start[ipatch];
-            while( i<patch_nParticles ) {
-                buffer[j] = (*property)[i];
-                i++; j++;
-            }
+    #pragma omp for schedule(runtime)
+    for (unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++) {
+        patch_nParticles = patch_selection[ipatch].size();
+        vecPatches(ipatch)->vecSpecies[speciesId_]->particles->getProperty(iprop, property);
+        i=0;
+        j=patch_start[ipatch];
+        while( i<patch_nParticles ) {
+            buffer[j] = (*property)[patch_selection[ipatch][i]];
+            i++; j++;
         }
     }
 }
@@ -72,7 +72,7 @@ private :
     //! Tells whether this diag includes a particle filter
     PyObject* filter;
     
-    //! Selection of the filtered particles in each patch
+    //! Selection of the filtered (or all) particles in each patch, ordered by Id
     std::vector<std::vector<unsigned int> > patch_selection;
     
     //! Buffer for the output of double array
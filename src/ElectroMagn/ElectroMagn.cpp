@@ -113,6 +113,10 @@ void ElectroMagn::initElectroMagnQuantities()
         Jz_s[ispec]  = NULL;
         rho_s[ispec] = NULL;
     }
+    Jx_s_now .resize(n_species, NULL);
+    Jy_s_now .resize(n_species, NULL);
+    Jz_s_now .resize(n_species, NULL);
+    rho_s_now.resize(n_species, NULL);
     
     for (unsigned int i=0; i<3; i++) {
         for (unsigned int j=0; j<2; j++) {
@@ -324,11 +328,12 @@ void ElectroMagn::restartRhoJ()
 
 void ElectroMagn::restartRhoJs()
 {
+    // Only the species densities deposited at this step are not zero
     for (unsigned int ispec=0 ; ispec < n_species ; ispec++) {
-        if( Jx_s [ispec] ) Jx_s [ispec]->put_to(0.);
-        if( Jy_s [ispec] ) Jy_s [ispec]->put_to(0.);
-        if( Jz_s [ispec] ) Jz_s [ispec]->put_to(0.);
-        if( rho_s[ispec] ) rho_s[ispec]->put_to(0.);
+        if( Jx_s_now [ispec] ) Jx_s_now [ispec]->put_to(0.);
+        if( Jy_s_now [ispec] ) Jy_s_now [ispec]->put_to(0.);
+        if( Jz_s_now [ispec] ) Jz_s_now [ispec]->put_to(0.);
+        if( rho_s_now[ispec] ) rho_s_now[ispec]->put_to(0.);
     }
     
     Jx_ ->put_to(0.);
@@ -337,6 +342,18 @@ void ElectroMagn::restartRhoJs()
     rho_->put_to(0.);
 }
 
+void ElectroMagn::selectRhoJs( vector<bool>& fields_needed )
+{
+    // The species fields are the last ones of allFields : Jx, Jy, Jz, Rho for each species
+    unsigned int ifield = allFields.size() - 4*n_species;
+    for (unsigned int ispec=0 ; ispec < n_species ; ispec++) {
+        Jx_s_now [ispec] = fields_needed[ifield++] ? Jx_s [ispec] : NULL;
+        Jy_s_now [ispec] = fields_needed[ifield++] ? Jy_s [ispec] : NULL;
+        Jz_s_now [ispec] = fields_needed[ifield++] ? Jz_s [ispec] : NULL;
+        rho_s_now[ispec] = fields_needed[ifield++] ? rho_s[ispec] : NULL;
+    }
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Increment an averaged field
 // ---------------------------------------------------------------------------------------------------------------------
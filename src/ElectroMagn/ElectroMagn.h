@@ -138,6 +138,12 @@ public:
     std::vector<Field*> Jy_s;
     std::vector<Field*> Jz_s;
     std::vector<Field*> rho_s;
+    //! Species densities deposited at the current diagnostic step : those required by the diagnostics (see selectRhoJs),
+    //! NULL for the others, the species then contribute directly to the total densities
+    std::vector<Field*> Jx_s_now;
+    std::vector<Field*> Jy_s_now;
+    std::vector<Field*> Jz_s_now;
+    std::vector<Field*> rho_s_now;
     
     //! Creates a new field with the right characteristics, depending on the name
     virtual Field * createField(std::string fieldname) = 0;
@@ -178,6 +184,9 @@ public:
     void restartRhoJ();
     //! Method used to initialize the total charge currents and densities of species
     void restartRhoJs();
+    //! Selects the species densities deposited at this diagnostic step among the allocated ones,
+    //! from the flags of the fields of allFields required by the diagnostics
+    void selectRhoJs( std::vector<bool>& fields_needed );
     
     //! Method used to sum all species densities and currents to compute the total charge density and currents
     virtual void computeTotalRhoJ() = 0;
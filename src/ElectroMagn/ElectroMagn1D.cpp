@@ -466,20 +466,20 @@ void ElectroMagn1D::computeTotalRhoJ()
     Field1D* rho1D   = static_cast<Field1D*>(rho_);
     
     for (unsigned int ispec=0; ispec<n_species; ispec++) {
-        if( Jx_s[ispec] ) {
-            Field1D* Jx1D_s  = static_cast<Field1D*>(Jx_s[ispec]);
+        if( Jx_s_now[ispec] ) {
+            Field1D* Jx1D_s  = static_cast<Field1D*>(Jx_s_now[ispec]);
             for (unsigned int ix=0 ; ix<=dimPrim[0] ; ix++) (*Jx1D)(ix)  += (*Jx1D_s)(ix);
         }
-        if( Jy_s[ispec] ) {
-            Field1D* Jy1D_s  = static_cast<Field1D*>(Jy_s[ispec]);
+        if( Jy_s_now[ispec] ) {
+            Field1D* Jy1D_s  = static_cast<Field1D*>(Jy_s_now[ispec]);
             for (unsigned int ix=0 ; ix<dimPrim[0] ; ix++) (*Jy1D)(ix)  += (*Jy1D_s)(ix);
         }
-        if( Jz_s[ispec] ) {
-            Field1D* Jz1D_s  = static_cast<Field1D*>(Jz_s[ispec]);
+        if( Jz_s_now[ispec] ) {
+            Field1D* Jz1D_s  = static_cast<Field1D*>(Jz_s_now[ispec]);
             for (unsigned int ix=0 ; ix<dimPrim[0] ; ix++) (*Jz1D)(ix)  += (*Jz1D_s)(ix);
         }
-        if( rho_s[ispec] ) {
-            Field1D* rho1D_s  = static_cast<Field1D*>(rho_s[ispec]);
+        if( rho_s_now[ispec] ) {
+            Field1D* rho1D_s  = static_cast<Field1D*>(rho_s_now[ispec]);
             for (unsigned int ix=0 ; ix<dimPrim[0] ; ix++) (*rho1D)(ix)  += (*rho1D_s)(ix);
         }
     }//END loop on species ispec
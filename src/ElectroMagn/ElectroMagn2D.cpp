@@ -667,26 +667,26 @@ void ElectroMagn2D::computeTotalRhoJ()
     // Species currents and charge density
     // -----------------------------------
     for (unsigned int ispec=0; ispec<n_species; ispec++) {
-        if( Jx_s[ispec] ) {
-            Field2D* Jx2D_s  = static_cast<Field2D*>(Jx_s[ispec]);
+        if( Jx_s_now[ispec] ) {
+            Field2D* Jx2D_s  = static_cast<Field2D*>(Jx_s_now[ispec]);
             for (unsigned int i=0 ; i<=nx_p ; i++)
                 for (unsigned int j=0 ; j<ny_p ; j++)
                     (*Jx2D)(i,j) += (*Jx2D_s)(i,j);
         }
-        if( Jy_s[ispec] ) {
-            Field2D* Jy2D_s  = static_cast<Field2D*>(Jy_s[ispec]);
+        if( Jy_s_now[ispec] ) {
+            Field2D* Jy2D_s  = static_cast<Field2D*>(Jy_s_now[ispec]);
             for (unsigned int i=0 ; i<nx_p ; i++)
                 for (unsigned int j=0 ; j<=ny_p ; j++)
                     (*Jy2D)(i,j) += (*Jy2D_s)(i,j);
         }
-        if( Jz_s[ispec] ) {
-            Field2D* Jz2D_s  = static_cast<Field2D*>(Jz_s[ispec]);
+        if( Jz_s_now[ispec] ) {
+            Field2D* Jz2D_s  = static_cast<Field2D*>(Jz_s_now[ispec]);
             for (unsigned int i=0 ; i<nx_p ; i++)
                 for (unsigned int j=0 ; j<ny_p ; j++)
                     (*Jz2D)(i,j) += (*Jz2D_s)(i,j);
         }
-        if( rho_s[ispec] ) {
-            Field2D* rho2D_s  = static_cast<Field2D*>(rho_s[ispec]);
+        if( rho_s_now[ispec] ) {
+            Field2D* rho2D_s  = static_cast<Field2D*>(rho_s_now[ispec]);
             for (unsigned int i=0 ; i<nx_p ; i++)
                 for (unsigned int j=0 ; j<ny_p ; j++)
                     (*rho2D)(i,j) += (*rho2D_s)(i,j);
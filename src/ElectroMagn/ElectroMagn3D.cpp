@@ -671,29 +671,29 @@ void ElectroMagn3D::computeTotalRhoJ()
     // Species currents and charge density
     // -----------------------------------
     for (unsigned int ispec=0; ispec<n_species; ispec++) {
-        if( Jx_s[ispec] ) {
-            Field3D* Jx3D_s  = static_cast<Field3D*>(Jx_s[ispec]);
+        if( Jx_s_now[ispec] ) {
+            Field3D* Jx3D_s  = static_cast<Field3D*>(Jx_s_now[ispec]);
             for (unsigned int i=0 ; i<=nx_p ; i++)
                 for (unsigned int j=0 ; j<ny_p ; j++)
                     for (unsigned int k=0 ; k<nz_p ; k++)
                         (*Jx3D)(i,j,k) += (*Jx3D_s)(i,j,k);
         }
-        if( Jy_s[ispec] ) {
-            Field3D* Jy3D_s  = static_cast<Field3D*>(Jy_s[ispec]);
+        if( Jy_s_now[ispec] ) {
+            Field3D* Jy3D_s  = static_cast<Field3D*>(Jy_s_now[ispec]);
             for (unsigned int i=0 ; i<nx_p ; i++)
                 for (unsigned int j=0 ; j<=ny_p ; j++)
                     for (unsigned int k=0 ; k<nz_p ; k++)
                         (*Jy3D)(i,j,k) += (*Jy3D_s)(i,j,k);
         }
-        if( Jz_s[ispec] ) {
-            Field3D* Jz3D_s  = static_cast<Field3D*>(Jz_s[ispec]);
+        if( Jz_s_now[ispec] ) {
+            Field3D* Jz3D_s  = static_cast<Field3D*>(Jz_s_now[ispec]);
             for (unsigned int i=0 ; i<nx_p ; i++)
                 for (unsigned int j=0 ; j<ny_p ; j++)
                     for (unsigned int k=0 ; k<=nz_p ; k++)
                         (*Jz3D)(i,j,k) += (*Jz3D_s)(i,j,k);
         }
-        if( rho_s[ispec] ) {
-            Field3D* rho3D_s  = static_cast<Field3D*>(rho_s[ispec]);
+        if( rho_s_now[ispec] ) {
+            Field3D* rho3D_s  = static_cast<Field3D*>(rho_s_now[ispec]);
             for (unsigned int i=0 ; i<nx_p ; i++)
                 for (unsigned int j=0 ; j<ny_p ; j++)
                     for (unsigned int k=0 ; k<nz_p ; k++)
@@ -4,12 +4,15 @@
 #include <cmath>
 
 #include <vector>
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <string>
 #include <iostream>
 #include <fstream>
 
 #include "Tools.h"
+#include "MemoryPool.h"
 #include "AsyncMPIbuffers.h"
 
 //! Structure containing the fields at a given position (e.g. at a Particle position)
@@ -68,6 +71,26 @@ public:
     //! Virtual method to deallocate Field
     virtual void deallocateDims() = 0;
     
+    //! Allocate n values for the data, possibly recycled from the MemoryPool
+    inline double* newData( unsigned int n ) {
+        size_t size = std::max( n, 1u )*sizeof(double);
+        return (double*)MemoryPool::allocate( size );
+    }
+    //! Release the data (allocated by newData) to the MemoryPool
+    inline void deleteData() {
+        MemoryPool::release( data_, std::max( globalDims_, 1u )*sizeof(double) );
+    }
+    
+    //! Reallocate the data from the calling thread, so that its pages are placed on the NUMA node of this thread
+    //! (first touch policy). The values are kept.
+    inline void firstTouch() {
+        if (!data_) return;
+        std::vector<double> values( data_, data_+globalDims_ );
+        deallocateDims();
+        allocateDims();
+        memcpy( data_, &(values[0]), globalDims_*sizeof(double) );
+    }
+    
     //! Virtual method used to make a dump of the Field data
     virtual void dump(std::vector<unsigned int> dims) = 0;
     
@@ -54,7 +54,7 @@ Field1D::Field1D(string name, vector<unsigned int> dims) : Field(dims, name)
 Field1D::~Field1D()
 {
     if (data_!=NULL) {
-        delete [] data_;
+        deleteData();
     }
 }
 
@@ -69,7 +69,7 @@ void Field1D::allocateDims()
     
     isDual_.resize( dims_.size(), 0 );
     
-    data_ = new double[ dims_[0] ];
+    data_ = newData( dims_[0] );
     //! \todo{change to memset (JD)}
     for (unsigned int i=0; i<dims_[0]; i++) data_[i]=0.0;
     
@@ -79,7 +79,7 @@ void Field1D::allocateDims()
 
 void Field1D::deallocateDims()
 {
-    delete [] data_;
+    deleteData();
     data_=NULL;
 }
 
@@ -113,7 +113,7 @@ void Field1D::allocateDims(unsigned int mainDim, bool isPrimal)
     for ( unsigned int j=0 ; j<dims_.size() ; j++ )
         dims_[j] += isDual_[j];
     
-    data_ = new double[ dims_[0] ];
+    data_ = newData( dims_[0] );
     //! \todo{change to memset (JD)}
     for (unsigned int i=0; i<dims_[0]; i++) data_[i]=0.0;
     
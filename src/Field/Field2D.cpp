@@ -62,7 +62,7 @@ Field2D::~Field2D()
 {
 
     if (data_!=NULL) {
-        delete [] data_;
+        deleteData();
         delete [] data_2D;
     }
 }
@@ -75,11 +75,11 @@ void Field2D::allocateDims()
 {
     //! \todo{Comment on what you are doing here (MG for JD)}
     if (dims_.size()!=2) ERROR("Alloc error must be 2 : " << dims_.size());
-    if (data_!=NULL) delete [] data_;
+    if (data_!=NULL) deleteData();
 
     isDual_.resize( dims_.size(), 0 );
 
-    data_ = new double[dims_[0]*dims_[1]];
+    data_ = newData( dims_[0]*dims_[1] );
     //! \todo{check row major order!!! (JD)}
 
     data_2D= new double*[dims_[0]];
@@ -94,7 +94,7 @@ void Field2D::allocateDims()
 
 void Field2D::deallocateDims()
 {
-    delete [] data_;
+    deleteData();
     data_ = NULL;
     delete [] data_2D;
     data_2D = NULL;
@@ -116,7 +116,7 @@ void Field2D::allocateDims(unsigned int mainDim, bool isPrimal )
 {
     //! \todo{Comment on what you are doing here (MG for JD)}
     if (dims_.size()!=2) ERROR("Alloc error must be 2 : " << dims_.size());
-    if (data_) delete [] data_;
+    if (data_) deleteData();
     
     // isPrimal define if mainDim is Primal or Dual
     isDual_.resize( dims_.size(), 0 );
@@ -130,7 +130,7 @@ void Field2D::allocateDims(unsigned int mainDim, bool isPrimal )
     for ( unsigned int j=0 ; j<dims_.size() ; j++ )
         dims_[j] += isDual_[j];
     
-    data_ = new double[dims_[0]*dims_[1]];
+    data_ = newData( dims_[0]*dims_[1] );
     //! \todo{check row major order!!! (JD)}
     
     data_2D= new double*[dims_[0]];
@@ -61,7 +61,7 @@ Field3D::Field3D(string name, vector<unsigned int> dims) : Field(dims, name)
 Field3D::~Field3D()
 {
     if (data_!=NULL) {
-        delete [] data_;
+        deleteData();
         for (unsigned int i=0; i<dims_[0]; i++) delete [] data_3D[i];
         delete [] data_3D;
     }
@@ -73,11 +73,11 @@ Field3D::~Field3D()
 // ---------------------------------------------------------------------------------------------------------------------
 void Field3D::allocateDims() {
     if (dims_.size()!=3) ERROR("Alloc error must be 3 : " << dims_.size());
-    if (data_) delete [] data_;
+    if (data_) deleteData();
     
     isDual_.resize( dims_.size(), 0 );
     
-    data_ = new double[dims_[0]*dims_[1]*dims_[2]];
+    data_ = newData( dims_[0]*dims_[1]*dims_[2] );
     //! \todo{check row major order!!!}
     data_3D= new double**[dims_[0]];
     for (unsigned int i=0; i<dims_[0]; i++)
@@ -97,7 +97,7 @@ void Field3D::allocateDims() {
 
 void Field3D::deallocateDims()
 {
-    delete [] data_;
+    deleteData();
     data_ = NULL;
     for (unsigned int i=0; i<dims_[0]; i++) delete [] data_3D[i];
     delete [] data_3D;
@@ -121,7 +121,7 @@ void Field3D::allocateDims(unsigned int dims1, unsigned int dims2, unsigned int
 // ---------------------------------------------------------------------------------------------------------------------
 void Field3D::allocateDims(unsigned int mainDim, bool isPrimal ) {
     if (dims_.size()!=3) ERROR("Alloc error must be 3 : " << dims_.size());
-    if (data_) delete [] data_;
+    if (data_) deleteData();
     
     // isPrimal define if mainDim is Primal or Dual
     isDual_.resize( dims_.size(), 0 );
@@ -135,7 +135,7 @@ void Field3D::allocateDims(unsigned int mainDim, bool isPrimal ) {
     for ( unsigned int j=0 ; j<dims_.size() ; j++ )
         dims_[j] += isDual_[j];
     
-    data_ = new double[dims_[0]*dims_[1]*dims_[2]];
+    data_ = newData( dims_[0]*dims_[1]*dims_[2] );
     //! \todo{check row major order!!!}
     data_3D= new double**[dims_[0]*dims_[1]];
     for (unsigned int i=0; i<dims_[0]; i++)
@@ -5,10 +5,40 @@
 
 #include "Params.h"
 #include "Patch.h"
+#include "Particles.h"
 
 using namespace std;
 
+const int Interpolator::block_size;
+
 Interpolator::Interpolator(Params &params, Patch* patch)
 {
 }
 
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Indices and distances to the central nodes of np particles at the positions x
+// ---------------------------------------------------------------------------------------------------------------------
+static inline void indicesAt( const double* x, int np, double inv_cell_length, int index_begin,
+                              int* ip, int* id, double* deltap, double* deltad )
+{
+    #pragma omp simd
+    for ( int ipart=0 ; ipart<np ; ipart++ ) {
+        double pos = x[ipart]*inv_cell_length;
+        ip[ipart] = round(pos);
+        id[ipart] = round(pos+0.5);
+        deltap[ipart] = pos - (double)ip[ipart];
+        deltad[ipart] = pos - (double)id[ipart] + 0.5;
+        ip[ipart] -= index_begin;
+        id[ipart] -= index_begin;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Indices and distances to the central nodes of a block of particles (positions are always stored in double)
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator::blockIndices( Particles &particles, int ivect, int np, unsigned int idim, double inv_cell_length, int index_begin,
+                                 int* ip, int* id, double* deltap, double* deltad )
+{
+    indicesAt( particles.Position[idim].data<double>()+ivect, np, inv_cell_length, index_begin, ip, id, deltap, deltad );
+}
@@ -22,6 +22,42 @@ public:
     virtual void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread) = 0;
     
     virtual void operator() (ElectroMagn* EMfields, Particles &particles, int ipart, LocalFields* ELoc, LocalFields* BLoc, LocalFields* JLoc, double* RhoLoc) = 0;
+    
+    //! Number of particles interpolated together by operator() (EMfields, particles, smpi, istart, iend, ithread)
+    static const int block_size = 8;
+
+protected:
+    //! Indices of the central primal and dual nodes (relative to index_begin) along idim, and the normalized distances
+    //! of the particles to these nodes, for the np particles from ivect
+    void blockIndices( Particles &particles, int ivect, int np, unsigned int idim, double inv_cell_length, int index_begin,
+                       int* ip, int* id, double* deltap, double* deltad );
+    
+    //! 2nd order coefficients (3 nodes) of np particles at the distances delta, stored by node : coeff[inode*block_size+ipart]
+    static inline void blockCoeffs2Order( const double* delta, double* coeff, int np ) {
+        #pragma omp simd
+        for ( int ipart=0 ; ipart<np ; ipart++ ) {
+            double delta2 = delta[ipart]*delta[ipart];
+            coeff[             ipart] = 0.5 * (delta2-delta[ipart]+0.25);
+            coeff[  block_size+ipart] = 0.75 - delta2;
+            coeff[2*block_size+ipart] = 0.5 * (delta2+delta[ipart]+0.25);
+        }
+    };
+    
+    //! 4th order coefficients (5 nodes) of np particles at the distances delta, stored by node : coeff[inode*block_size+ipart]
+    static inline void blockCoeffs4Order( const double* delta, double* coeff, int np ) {
+        #pragma omp simd
+        for ( int ipart=0 ; ipart<np ; ipart++ ) {
+            double delta1 = delta[ipart];
+            double delta2 = delta1*delta1;
+            double delta3 = delta2*delta1;
+            double delta4 = delta3*delta1;
+            coeff[             ipart] = 1./384.   - 1./48.  * delta1 + 1./16. * delta2 - 1./12. * delta3 + 1./24. * delta4;
+            coeff[  block_size+ipart] = 19./96.   - 11./24. * delta1 + 1./4.  * delta2 + 1./6.  * delta3 - 1./6.  * delta4;
+            coeff[2*block_size+ipart] = 115./192. - 5./8.   * delta2 + 1./4.  * delta4;
+            coeff[3*block_size+ipart] = 19./96.   + 11./24. * delta1 + 1./4.  * delta2 - 1./6.  * delta3 - 1./6.  * delta4;
+            coeff[4*block_size+ipart] = 1./384.   + 1./48.  * delta1 + 1./16. * delta2 + 1./12. * delta3 + 1./24. * delta4;
+        }
+    };
 
 private:
 
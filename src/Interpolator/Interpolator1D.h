@@ -3,6 +3,7 @@
 
 
 #include "Interpolator.h"
+#include "Field1D.h"
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class Interpolator 1D
@@ -18,6 +19,20 @@ public:
     virtual void operator() (ElectroMagn* EMfields, Particles &particles, int ipart, LocalFields* ELoc, LocalFields* BLoc, LocalFields* JLoc, double* RhoLoc) override = 0;
 
 protected:
+    //! Interpolate f for the np particles of a block, from their central nodes idx and their coefficients on the
+    //! 2*half+1 nodes around them (stored by node, see Interpolator::blockCoeffs2Order)
+    template<int half>
+    inline void computeBlock( const double* coeffx, Field1D* f, const int* idx, double* res, int np ) {
+        const double* data = f->data_;
+        #pragma omp simd
+        for ( int ipart=0 ; ipart<np ; ipart++ ) {
+            double interp_res(0.);
+            for ( int iloc=-half ; iloc<=half ; iloc++ )
+                interp_res += coeffx[(iloc+half)*block_size+ipart] * data[idx[ipart]+iloc];
+            res[ipart] = interp_res;
+        }
+    };
+    
     //! Inverse of the spatial-step
     double dx_inv_;
     unsigned int index_domain_begin;
@@ -34,10 +34,13 @@ void Interpolator1D2Order::operator() (ElectroMagn* EMfields, Particles &particl
     // Particle position (in units of the spatial-step)
     xjn    = particles.position(0, ipart)*dx_inv_;
     
+    // Indexes of the central points
+    ip_ = round(xjn);
+    id_ = round(xjn+0.5);
+    
     // --------------------------------------------------------
     // Interpolate the fields from the Dual grid : Ex, By, Bz
     // --------------------------------------------------------
-    id_      = round(xjn+0.5);        // index of the central point
     xjmxi  = xjn - (double)id_ +0.5;  // normalized distance to the central node
     xjmxi2 = xjmxi*xjmxi;            // square of the normalized distance to the central node
     
@@ -55,7 +58,6 @@ void Interpolator1D2Order::operator() (ElectroMagn* EMfields, Particles &particl
     // --------------------------------------------------------
     // Interpolate the fields from the Primal grid : Ey, Ez, Bx
     // --------------------------------------------------------
-    ip_      = round(xjn);      // index of the central point
     xjmxi  = xjn -(double)ip_;  // normalized distance to the central node
     xjmxi2 = pow(xjmxi,2);      // square of the normalized distance to the central node
     
@@ -100,18 +102,45 @@ void Interpolator1D2Order::operator() (ElectroMagn* EMfields, Particles &particl
 
 void Interpolator1D2Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    int nparts = smpi->dynamics_Epart[ithread].size()/3;
+    double* Epart = smpi->dynamics_Epart[ithread].data();
+    double* Bpart = smpi->dynamics_Bpart[ithread].data();
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
     
-    //Loop on bin particles
-    for (int ipart=istart ; ipart<iend; ipart++ ) {
-        //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, &(*Epart)[ipart], &(*Bpart)[ipart]);
-        //Buffering of iol and delta
-        (*iold)[ipart] = ip_;
-        (*delta)[ipart] = xjmxi;
+    // Static cast of the electromagnetic fields
+    Field1D* Ex1D = static_cast<Field1D*>(EMfields->Ex_);
+    Field1D* Ey1D = static_cast<Field1D*>(EMfields->Ey_);
+    Field1D* Ez1D = static_cast<Field1D*>(EMfields->Ez_);
+    Field1D* Bx1D = static_cast<Field1D*>(EMfields->Bx_m);
+    Field1D* By1D = static_cast<Field1D*>(EMfields->By_m);
+    Field1D* Bz1D = static_cast<Field1D*>(EMfields->Bz_m);
+    
+    // The particles are interpolated by blocks of block_size : the indices and coefficients of the block are computed
+    // in SoA arrays, then each field component is gathered for the whole block (both loops are vectorized)
+    int ip[block_size], id[block_size];
+    double deltaxp[block_size], deltaxd[block_size];
+    double coeffxp[3*block_size], coeffxd[3*block_size];
+    
+    for (int ivect=istart ; ivect<iend; ivect+=block_size ) {
+        int np = min( block_size, iend-ivect );
+        
+        blockIndices( particles, ivect, np, 0, dx_inv_, index_domain_begin, ip, id, deltaxp, deltaxd );
+        blockCoeffs2Order( deltaxp, coeffxp, np );
+        blockCoeffs2Order( deltaxd, coeffxd, np );
+        
+        computeBlock<1>( coeffxd, Ex1D, id, &Epart[ivect], np );
+        computeBlock<1>( coeffxp, Ey1D, ip, &Epart[nparts+ivect], np );
+        computeBlock<1>( coeffxp, Ez1D, ip, &Epart[2*nparts+ivect], np );
+        computeBlock<1>( coeffxp, Bx1D, ip, &Bpart[ivect], np );
+        computeBlock<1>( coeffxd, By1D, id, &Bpart[nparts+ivect], np );
+        computeBlock<1>( coeffxd, Bz1D, id, &Bpart[2*nparts+ivect], np );
+        
+        //Buffering of iold and delta
+        for (int ipart=0 ; ipart<np ; ipart++ ) {
+            (*iold)[ivect+ipart] = ip[ipart];
+            (*delta)[ivect+ipart] = deltaxp[ipart];
+        }
     }
     
 }
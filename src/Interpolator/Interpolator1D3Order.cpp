@@ -106,15 +106,24 @@ void Interpolator1D3Order::operator() (ElectroMagn* EMfields, Particles &particl
 }
 void Interpolator1D3Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    int nparts = smpi->dynamics_Epart[ithread].size()/3;
+    double* Epart = smpi->dynamics_Epart[ithread].data();
+    double* Bpart = smpi->dynamics_Bpart[ithread].data();
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
     
+    LocalFields ELoc, BLoc;
+    
     //Loop on bin particles
     for (int ipart=istart ; ipart<iend; ipart++ ) {
         //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, &(*Epart)[ipart], &(*Bpart)[ipart]);
+        (*this)(EMfields, particles, ipart, &ELoc, &BLoc);
+        Epart[         ipart] = ELoc.x;
+        Epart[  nparts+ipart] = ELoc.y;
+        Epart[2*nparts+ipart] = ELoc.z;
+        Bpart[         ipart] = BLoc.x;
+        Bpart[  nparts+ipart] = BLoc.y;
+        Bpart[2*nparts+ipart] = BLoc.z;
         //Buffering of iol and delta
         (*iold)[ipart] = ip_;
         (*delta)[ipart] = xi;
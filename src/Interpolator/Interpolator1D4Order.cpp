@@ -124,19 +124,46 @@ void Interpolator1D4Order::operator() (ElectroMagn* EMfields, Particles &particl
 }
 void Interpolator1D4Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    int nparts = smpi->dynamics_Epart[ithread].size()/3;
+    double* Epart = smpi->dynamics_Epart[ithread].data();
+    double* Bpart = smpi->dynamics_Bpart[ithread].data();
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
     
-    //Loop on bin particles
-    for (int ipart=istart ; ipart<iend; ipart++ ) {
-        //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, &(*Epart)[ipart], &(*Bpart)[ipart]);
-        //Buffering of iol and delta
-        (*iold)[ipart] = ip_;
-        (*delta)[ipart] = xjmxi;
+    // Static cast of the electromagnetic fields
+    Field1D* Ex1D = static_cast<Field1D*>(EMfields->Ex_);
+    Field1D* Ey1D = static_cast<Field1D*>(EMfields->Ey_);
+    Field1D* Ez1D = static_cast<Field1D*>(EMfields->Ez_);
+    Field1D* Bx1D = static_cast<Field1D*>(EMfields->Bx_m);
+    Field1D* By1D = static_cast<Field1D*>(EMfields->By_m);
+    Field1D* Bz1D = static_cast<Field1D*>(EMfields->Bz_m);
+    
+    // The particles are interpolated by blocks of block_size : the indices and coefficients of the block are computed
+    // in SoA arrays, then each field component is gathered for the whole block (both loops are vectorized)
+    int ip[block_size], id[block_size];
+    double deltaxp[block_size], deltaxd[block_size];
+    double coeffxp[5*block_size], coeffxd[5*block_size];
+    
+    for (int ivect=istart ; ivect<iend; ivect+=block_size ) {
+        int np = min( block_size, iend-ivect );
+        
+        blockIndices( particles, ivect, np, 0, dx_inv_, index_domain_begin, ip, id, deltaxp, deltaxd );
+        blockCoeffs4Order( deltaxp, coeffxp, np );
+        blockCoeffs4Order( deltaxd, coeffxd, np );
+        
+        computeBlock<2>( coeffxd, Ex1D, id, &Epart[ivect], np );
+        computeBlock<2>( coeffxp, Ey1D, ip, &Epart[nparts+ivect], np );
+        computeBlock<2>( coeffxp, Ez1D, ip, &Epart[2*nparts+ivect], np );
+        computeBlock<2>( coeffxp, Bx1D, ip, &Bpart[ivect], np );
+        computeBlock<2>( coeffxd, By1D, id, &Bpart[nparts+ivect], np );
+        computeBlock<2>( coeffxd, Bz1D, id, &Bpart[2*nparts+ivect], np );
+        
+        //Buffering of iold and delta
+        for (int ipart=0 ; ipart<np ; ipart++ ) {
+            (*iold)[ivect+ipart] = ip[ipart];
+            (*delta)[ivect+ipart] = deltaxp[ipart];
+        }
     }
-
+    
 }
 
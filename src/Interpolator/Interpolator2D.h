@@ -3,6 +3,7 @@
 
 
 #include "Interpolator.h"
+#include "Field2D.h"
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class Interpolator 2D
@@ -18,6 +19,25 @@ public:
     virtual void operator()  (ElectroMagn* EMfields, Particles &particles, int ipart, LocalFields* ELoc, LocalFields* BLoc, LocalFields* JLoc, double* RhoLoc) override = 0;
 
 protected:
+    //! Interpolate f for the np particles of a block, from their central nodes (idx, idy) and their coefficients on the
+    //! 2*half+1 nodes around them in each direction (stored by node, see Interpolator::blockCoeffs2Order)
+    template<int half>
+    inline void computeBlock( const double* coeffx, const double* coeffy, Field2D* f, const int* idx, const int* idy, double* res, int np ) {
+        const double* data = f->data_;
+        const int ny = f->dims_[1];
+        #pragma omp simd
+        for ( int ipart=0 ; ipart<np ; ipart++ ) {
+            double interp_res(0.);
+            for ( int iloc=-half ; iloc<=half ; iloc++ ) {
+                for ( int jloc=-half ; jloc<=half ; jloc++ ) {
+                    interp_res += coeffx[(iloc+half)*block_size+ipart] * coeffy[(jloc+half)*block_size+ipart]
+                                * data[ (idx[ipart]+iloc)*ny + idy[ipart]+jloc ];
+                }
+            }
+            res[ipart] = interp_res;
+        }
+    };
+    
     //! Inverse of the spatial-step
     double dx_inv_;
     double dy_inv_;
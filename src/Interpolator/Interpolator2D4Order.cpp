@@ -70,41 +70,41 @@ void Interpolator2D4Order::operator() (ElectroMagn* EMfields, Particles &particl
     delta2  = deltax*deltax;
     delta3  = delta2*deltax;
     delta4  = delta3*deltax;
-    coeffxd_[0] = dble_1_ov_384   - dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffxd_[0] = dble_1_ov_384   - dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
     coeffxd_[1] = dble_19_ov_96   - dble_11_ov_24 * deltax  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
     coeffxd_[2] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
     coeffxd_[3] = dble_19_ov_96   + dble_11_ov_24 * deltax  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
-    coeffxd_[4] = dble_1_ov_384   + dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffxd_[4] = dble_1_ov_384   + dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
     
     deltax   = xpn - (double)ip_;
     delta2  = deltax*deltax;
     delta3  = delta2*deltax;
     delta4  = delta3*deltax;
-    coeffxp_[0] = dble_1_ov_384   - dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffxp_[0] = dble_1_ov_384   - dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
     coeffxp_[1] = dble_19_ov_96   - dble_11_ov_24 * deltax  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
     coeffxp_[2] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
     coeffxp_[3] = dble_19_ov_96   + dble_11_ov_24 * deltax  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
-    coeffxp_[4] = dble_1_ov_384   + dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffxp_[4] = dble_1_ov_384   + dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
     
     deltay   = ypn - (double)jd_ + 0.5;
     delta2  = deltay*deltay;
     delta3  = delta2*deltay;
     delta4  = delta3*deltay;
-    coeffyd_[0] = dble_1_ov_384   - dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffyd_[0] = dble_1_ov_384   - dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
     coeffyd_[1] = dble_19_ov_96   - dble_11_ov_24 * deltay  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
     coeffyd_[2] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
     coeffyd_[3] = dble_19_ov_96   + dble_11_ov_24 * deltay  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
-    coeffyd_[4] = dble_1_ov_384   + dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffyd_[4] = dble_1_ov_384   + dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
     
     deltay   = ypn - (double)jp_;
     delta2  = deltay*deltay;
     delta3  = delta2*deltay;
     delta4  = delta3*deltay;
-    coeffyp_[0] = dble_1_ov_384   - dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffyp_[0] = dble_1_ov_384   - dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
     coeffyp_[1] = dble_19_ov_96   - dble_11_ov_24 * deltay  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
     coeffyp_[2] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
     coeffyp_[3] = dble_19_ov_96   + dble_11_ov_24 * deltay  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
-    coeffyp_[4] = dble_1_ov_384   + dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffyp_[4] = dble_1_ov_384   + dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
     
     
     
@@ -185,20 +185,50 @@ void Interpolator2D4Order::operator() (ElectroMagn* EMfields, Particles &particl
 }
 void Interpolator2D4Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    int nparts = smpi->dynamics_Epart[ithread].size()/3;
+    double* Epart = smpi->dynamics_Epart[ithread].data();
+    double* Bpart = smpi->dynamics_Bpart[ithread].data();
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
     
-    //Loop on bin particles
-    for (int ipart=istart ; ipart<iend; ipart++ ) {
-        //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, &(*Epart)[ipart], &(*Bpart)[ipart]);
-        //Buffering of iol and delta
-        (*iold)[ipart*2] = ip_;
-        (*iold)[ipart*2+1] = jp_;
-        (*delta)[ipart*2] = deltax;
-        (*delta)[ipart*2+1] = deltay;
+    // Static cast of the electromagnetic fields
+    Field2D* Ex2D = static_cast<Field2D*>(EMfields->Ex_);
+    Field2D* Ey2D = static_cast<Field2D*>(EMfields->Ey_);
+    Field2D* Ez2D = static_cast<Field2D*>(EMfields->Ez_);
+    Field2D* Bx2D = static_cast<Field2D*>(EMfields->Bx_m);
+    Field2D* By2D = static_cast<Field2D*>(EMfields->By_m);
+    Field2D* Bz2D = static_cast<Field2D*>(EMfields->Bz_m);
+    
+    // The particles are interpolated by blocks of block_size : the indices and coefficients of the block are computed
+    // in SoA arrays, then each field component is gathered for the whole block (both loops are vectorized)
+    int ip[block_size], id[block_size], jp[block_size], jd[block_size];
+    double deltaxp[block_size], deltaxd[block_size], deltayp[block_size], deltayd[block_size];
+    double coeffxp[5*block_size], coeffxd[5*block_size], coeffyp[5*block_size], coeffyd[5*block_size];
+    
+    for (int ivect=istart ; ivect<iend; ivect+=block_size ) {
+        int np = min( block_size, iend-ivect );
+        
+        blockIndices( particles, ivect, np, 0, dx_inv_, i_domain_begin, ip, id, deltaxp, deltaxd );
+        blockIndices( particles, ivect, np, 1, dy_inv_, j_domain_begin, jp, jd, deltayp, deltayd );
+        blockCoeffs4Order( deltaxp, coeffxp, np );
+        blockCoeffs4Order( deltaxd, coeffxd, np );
+        blockCoeffs4Order( deltayp, coeffyp, np );
+        blockCoeffs4Order( deltayd, coeffyd, np );
+        
+        computeBlock<2>( coeffxd, coeffyp, Ex2D, id, jp, &Epart[ivect], np );
+        computeBlock<2>( coeffxp, coeffyd, Ey2D, ip, jd, &Epart[nparts+ivect], np );
+        computeBlock<2>( coeffxp, coeffyp, Ez2D, ip, jp, &Epart[2*nparts+ivect], np );
+        computeBlock<2>( coeffxp, coeffyd, Bx2D, ip, jd, &Bpart[ivect], np );
+        computeBlock<2>( coeffxd, coeffyp, By2D, id, jp, &Bpart[nparts+ivect], np );
+        computeBlock<2>( coeffxd, coeffyd, Bz2D, id, jd, &Bpart[2*nparts+ivect], np );
+        
+        //Buffering of iold and delta
+        for (int ipart=0 ; ipart<np ; ipart++ ) {
+            (*iold)[(ivect+ipart)*2+0] = ip[ipart];
+            (*iold)[(ivect+ipart)*2+1] = jp[ipart];
+            (*delta)[(ivect+ipart)*2+0] = deltaxp[ipart];
+            (*delta)[(ivect+ipart)*2+1] = deltayp[ipart];
+        }
     }
-
+    
 }
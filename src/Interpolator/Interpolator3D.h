@@ -3,6 +3,7 @@
 
 
 #include "Interpolator.h"
+#include "Field3D.h"
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class Interpolator 3D
@@ -18,6 +19,30 @@ public:
     virtual void operator()  (ElectroMagn* EMfields, Particles &particles, int ipart, LocalFields* ELoc, LocalFields* BLoc, LocalFields* JLoc, double* RhoLoc) override = 0;
 
 protected:
+    //! Interpolate f for the np particles of a block, from their central nodes (idx, idy, idz) and their coefficients on
+    //! the 2*half+1 nodes around them in each direction (stored by node, see Interpolator::blockCoeffs2Order)
+    template<int half>
+    inline void computeBlock( const double* coeffx, const double* coeffy, const double* coeffz, Field3D* f,
+                              const int* idx, const int* idy, const int* idz, double* res, int np ) {
+        const double* data = f->data_;
+        const int ny = f->dims_[1];
+        const int nz = f->dims_[2];
+        #pragma omp simd
+        for ( int ipart=0 ; ipart<np ; ipart++ ) {
+            double interp_res(0.);
+            for ( int iloc=-half ; iloc<=half ; iloc++ ) {
+                for ( int jloc=-half ; jloc<=half ; jloc++ ) {
+                    double cxy = coeffx[(iloc+half)*block_size+ipart] * coeffy[(jloc+half)*block_size+ipart];
+                    for ( int kloc=-half ; kloc<=half ; kloc++ ) {
+                        interp_res += cxy * coeffz[(kloc+half)*block_size+ipart]
+                                    * data[ ((idx[ipart]+iloc)*ny + idy[ipart]+jloc)*nz + idz[ipart]+kloc ];
+                    }
+                }
+            }
+            res[ipart] = interp_res;
+        }
+    };
+    
     //! Inverse of the spatial-step
     double dx_inv_;
     double dy_inv_;
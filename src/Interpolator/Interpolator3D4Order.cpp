@@ -71,61 +71,61 @@ void Interpolator3D4Order::operator() (ElectroMagn* EMfields, Particles &particl
     delta2  = deltax*deltax;
     delta3  = delta2*deltax;
     delta4  = delta3*deltax;
-    coeffxd_[0] = dble_1_ov_384   - dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffxd_[0] = dble_1_ov_384   - dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
     coeffxd_[1] = dble_19_ov_96   - dble_11_ov_24 * deltax  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
     coeffxd_[2] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
     coeffxd_[3] = dble_19_ov_96   + dble_11_ov_24 * deltax  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
-    coeffxd_[4] = dble_1_ov_384   + dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffxd_[4] = dble_1_ov_384   + dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
 
     deltax   = xpn - (double)ip_;
     delta2  = deltax*deltax;
     delta3  = delta2*deltax;
     delta4  = delta3*deltax;
-    coeffxp_[0] = dble_1_ov_384   - dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffxp_[0] = dble_1_ov_384   - dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
     coeffxp_[1] = dble_19_ov_96   - dble_11_ov_24 * deltax  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
     coeffxp_[2] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
     coeffxp_[3] = dble_19_ov_96   + dble_11_ov_24 * deltax  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
-    coeffxp_[4] = dble_1_ov_384   + dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffxp_[4] = dble_1_ov_384   + dble_1_ov_48  * deltax  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
 
     deltay   = ypn - (double)jd_ + 0.5;
     delta2  = deltay*deltay;
     delta3  = delta2*deltay;
     delta4  = delta3*deltay;
-    coeffyd_[0] = dble_1_ov_384   - dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffyd_[0] = dble_1_ov_384   - dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
     coeffyd_[1] = dble_19_ov_96   - dble_11_ov_24 * deltay  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
     coeffyd_[2] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
     coeffyd_[3] = dble_19_ov_96   + dble_11_ov_24 * deltay  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
-    coeffyd_[4] = dble_1_ov_384   + dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffyd_[4] = dble_1_ov_384   + dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
 
     deltay   = ypn - (double)jp_;
     delta2  = deltay*deltay;
     delta3  = delta2*deltay;
     delta4  = delta3*deltay;
-    coeffyp_[0] = dble_1_ov_384   - dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffyp_[0] = dble_1_ov_384   - dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
     coeffyp_[1] = dble_19_ov_96   - dble_11_ov_24 * deltay  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
     coeffyp_[2] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
     coeffyp_[3] = dble_19_ov_96   + dble_11_ov_24 * deltay  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
-    coeffyp_[4] = dble_1_ov_384   + dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffyp_[4] = dble_1_ov_384   + dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
 
     deltaz   = zpn - (double)kd_ + 0.5;
     delta2  = deltaz*deltaz;
     delta3  = delta2*deltaz;
     delta4  = delta3*deltaz;
-    coeffzd_[0] = dble_1_ov_384   - dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
-    coeffzd_[1] = dble_19_ov_96   - dble_11_ov_24 * deltay  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    coeffzd_[0] = dble_1_ov_384   - dble_1_ov_48  * deltaz  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    coeffzd_[1] = dble_19_ov_96   - dble_11_ov_24 * deltaz  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
     coeffzd_[2] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
-    coeffzd_[3] = dble_19_ov_96   + dble_11_ov_24 * deltay  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
-    coeffzd_[4] = dble_1_ov_384   + dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffzd_[3] = dble_19_ov_96   + dble_11_ov_24 * deltaz  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    coeffzd_[4] = dble_1_ov_384   + dble_1_ov_48  * deltaz  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
 
     deltaz   = zpn - (double)kp_;
     delta2  = deltaz*deltaz;
     delta3  = delta2*deltaz;
     delta4  = delta3*deltaz;
-    coeffzp_[0] = dble_1_ov_384   - dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
-    coeffzp_[1] = dble_19_ov_96   - dble_11_ov_24 * deltay  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    coeffzp_[0] = dble_1_ov_384   - dble_1_ov_48  * deltaz  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    coeffzp_[1] = dble_19_ov_96   - dble_11_ov_24 * deltaz  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
     coeffzp_[2] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
-    coeffzp_[3] = dble_19_ov_96   + dble_11_ov_24 * deltay  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
-    coeffzp_[4] = dble_1_ov_384   + dble_1_ov_48  * deltay  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+    coeffzp_[3] = dble_19_ov_96   + dble_11_ov_24 * deltaz  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    coeffzp_[4] = dble_1_ov_384   + dble_1_ov_48  * deltaz  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
 
 
     //!\todo CHECK if this is correct for both primal & dual grids !!!
@@ -207,22 +207,55 @@ void Interpolator3D4Order::operator() (ElectroMagn* EMfields, Particles &particl
 
 void Interpolator3D4Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    int nparts = smpi->dynamics_Epart[ithread].size()/3;
+    double* Epart = smpi->dynamics_Epart[ithread].data();
+    double* Bpart = smpi->dynamics_Bpart[ithread].data();
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
-
-    //Loop on bin particles
-    for (int ipart=istart ; ipart<iend; ipart++ ) {
-        //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, &(*Epart)[ipart], &(*Bpart)[ipart]);
-        //Buffering of iol and delta
-        (*iold)[ipart*3]    = ip_;
-        (*iold)[ipart*3+1]  = jp_;
-        (*iold)[ipart*3+2]  = kp_;
-        (*delta)[ipart*3]   = deltax;
-        (*delta)[ipart*3+1] = deltay;
-        (*delta)[ipart*3+2] = deltaz;
+    
+    // Static cast of the electromagnetic fields
+    Field3D* Ex3D = static_cast<Field3D*>(EMfields->Ex_);
+    Field3D* Ey3D = static_cast<Field3D*>(EMfields->Ey_);
+    Field3D* Ez3D = static_cast<Field3D*>(EMfields->Ez_);
+    Field3D* Bx3D = static_cast<Field3D*>(EMfields->Bx_m);
+    Field3D* By3D = static_cast<Field3D*>(EMfields->By_m);
+    Field3D* Bz3D = static_cast<Field3D*>(EMfields->Bz_m);
+    
+    // The particles are interpolated by blocks of block_size : the indices and coefficients of the block are computed
+    // in SoA arrays, then each field component is gathered for the whole block (both loops are vectorized)
+    int ip[block_size], id[block_size], jp[block_size], jd[block_size], kp[block_size], kd[block_size];
+    double deltaxp[block_size], deltaxd[block_size], deltayp[block_size], deltayd[block_size], deltazp[block_size], deltazd[block_size];
+    double coeffxp[5*block_size], coeffxd[5*block_size], coeffyp[5*block_size], coeffyd[5*block_size], coeffzp[5*block_size], coeffzd[5*block_size];
+    
+    for (int ivect=istart ; ivect<iend; ivect+=block_size ) {
+        int np = min( block_size, iend-ivect );
+        
+        blockIndices( particles, ivect, np, 0, dx_inv_, i_domain_begin, ip, id, deltaxp, deltaxd );
+        blockIndices( particles, ivect, np, 1, dy_inv_, j_domain_begin, jp, jd, deltayp, deltayd );
+        blockIndices( particles, ivect, np, 2, dz_inv_, k_domain_begin, kp, kd, deltazp, deltazd );
+        blockCoeffs4Order( deltaxp, coeffxp, np );
+        blockCoeffs4Order( deltaxd, coeffxd, np );
+        blockCoeffs4Order( deltayp, coeffyp, np );
+        blockCoeffs4Order( deltayd, coeffyd, np );
+        blockCoeffs4Order( deltazp, coeffzp, np );
+        blockCoeffs4Order( deltazd, coeffzd, np );
+        
+        computeBlock<2>( coeffxd, coeffyp, coeffzp, Ex3D, id, jp, kp, &Epart[ivect], np );
+        computeBlock<2>( coeffxp, coeffyd, coeffzp, Ey3D, ip, jd, kp, &Epart[nparts+ivect], np );
+        computeBlock<2>( coeffxp, coeffyp, coeffzd, Ez3D, ip, jp, kd, &Epart[2*nparts+ivect], np );
+        computeBlock<2>( coeffxp, coeffyd, coeffzd, Bx3D, ip, jd, kd, &Bpart[ivect], np );
+        computeBlock<2>( coeffxd, coeffyp, coeffzd, By3D, id, jp, kd, &Bpart[nparts+ivect], np );
+        computeBlock<2>( coeffxd, coeffyd, coeffzp, Bz3D, id, jd, kp, &Bpart[2*nparts+ivect], np );
+        
+        //Buffering of iold and delta
+        for (int ipart=0 ; ipart<np ; ipart++ ) {
+            (*iold)[(ivect+ipart)*3+0] = ip[ipart];
+            (*iold)[(ivect+ipart)*3+1] = jp[ipart];
+            (*iold)[(ivect+ipart)*3+2] = kp[ipart];
+            (*delta)[(ivect+ipart)*3+0] = deltaxp[ipart];
+            (*delta)[(ivect+ipart)*3+1] = deltayp[ipart];
+            (*delta)[(ivect+ipart)*3+2] = deltazp[ipart];
+        }
     }
-
+    
 }
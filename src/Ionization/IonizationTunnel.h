@@ -19,7 +19,7 @@ public:
     IonizationTunnel(Params& params, Species * species);
     
     //! apply the Tunnel Ionization model to the species (with ionization current)
-    void operator() (Particles*, unsigned int, unsigned int, std::vector<LocalFields>*, ElectroMagn*, Projector*) override;
+    void operator() (Particles*, unsigned int, unsigned int, std::vector<double>*, ElectroMagn*, Projector*) override;
     
     double one_third;
     std::vector<double> alpha_tunnel, beta_tunnel, gamma_tunnel;
@@ -0,0 +1,92 @@
+#include "Merging.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "Species.h"
+
+using namespace std;
+
+Merging::Merging(Params& params, Species * species) {
+
+    merge_every            = species->merge_every;
+    min_particles_per_cell = species->merge_min_particles_per_cell;
+    momentum_cells         = species->merge_momentum_cells;
+    
+    nDim_particle          = params.nDim_particle;
+    cell_length_inv.resize(nDim_particle);
+    for (unsigned int i=0; i<nDim_particle; i++)
+        cell_length_inv[i] = 1./params.cell_length[i];
+}
+
+
+Merging::~Merging() {
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Merge the particles of one bin, cell by cell
+// ---------------------------------------------------------------------------------------------------------------------
+void Merging::operator() (Particles* particles, unsigned int ipart_min, unsigned int ipart_max, vector<int>& remove_list) {
+    
+    if ( ipart_max-ipart_min < max(min_particles_per_cell, (unsigned int)3) ) return;
+    
+    vector<unsigned int> indexes, cell_start, cell_indexes;
+    sortByCell( particles, ipart_min, ipart_max, indexes, cell_start );
+    
+    for (unsigned int icell=0; icell<cell_start.size()-1; icell++) {
+        if (cell_start[icell+1]-cell_start[icell] < max(min_particles_per_cell, (unsigned int)3)) continue;
+        cell_indexes.assign( indexes.begin()+cell_start[icell], indexes.begin()+cell_start[icell+1] );
+        mergeCell( particles, cell_indexes, remove_list );
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Sort the particles of one bin by cell (counting sort on the cells of the bin)
+// ---------------------------------------------------------------------------------------------------------------------
+void Merging::sortByCell(Particles* particles, unsigned int ipart_min, unsigned int ipart_max,
+                         vector<unsigned int>& indexes, vector<unsigned int>& cell_start) {
+    
+    unsigned int npart = ipart_max-ipart_min;
+    indexes.resize(npart);
+    cell_start.clear();
+    if (npart==0) {
+        cell_start.push_back(0);
+        return;
+    }
+    
+    // Extent of the cells of the bin
+    int cmin[3], cmax[3], c[3];
+    cellOf( particles, ipart_min, cmin );
+    cellOf( particles, ipart_min, cmax );
+    for (unsigned int ipart=ipart_min+1; ipart<ipart_max; ipart++) {
+        cellOf( particles, ipart, c );
+        for (unsigned int i=0; i<3; i++) {
+            if (c[i]<cmin[i]) cmin[i] = c[i];
+            if (c[i]>cmax[i]) cmax[i] = c[i];
+        }
+    }
+    unsigned int n[3];
+    for (unsigned int i=0; i<3; i++) n[i] = cmax[i]-cmin[i]+1;
+    
+    // Count the particles in each cell
+    vector<unsigned int> cell_of_part(npart), count(n[0]*n[1]*n[2]+1, 0);
+    for (unsigned int ipart=ipart_min; ipart<ipart_max; ipart++) {
+        cellOf( particles, ipart, c );
+        unsigned int icell = ( (c[0]-cmin[0])*n[1] + c[1]-cmin[1] )*n[2] + c[2]-cmin[2];
+        cell_of_part[ipart-ipart_min] = icell;
+        count[icell+1]++;
+    }
+    for (unsigned int icell=1; icell<count.size(); icell++)
+        count[icell] += count[icell-1];
+    
+    // Non-empty cells
+    for (unsigned int icell=0; icell<count.size()-1; icell++)
+        if (count[icell+1]>count[icell]) cell_start.push_back(count[icell]);
+    cell_start.push_back(npart);
+    
+    // Place the particles
+    for (unsigned int ipart=ipart_min; ipart<ipart_max; ipart++)
+        indexes[ count[cell_of_part[ipart-ipart_min]]++ ] = ipart;
+}
@@ -0,0 +1,56 @@
+#ifndef MERGING_H
+#define MERGING_H
+
+#include <vector>
+
+#include "Tools.h"
+#include "Params.h"
+#include "Particles.h"
+
+class Species;
+
+//! Class Merging: generic class allowing to merge macro-particles
+class Merging
+{
+
+public:
+    //! Constructor for Merging
+    Merging(Params& params, Species * species);
+    virtual ~Merging();
+    
+    //! Overloading of () operator: merges the particles ipart_min to ipart_max-1 (one bin)
+    //! in the cells containing at least min_particles_per_cell particles,
+    //! and appends the indexes of the particles to be removed to remove_list
+    void operator() (Particles*, unsigned int ipart_min, unsigned int ipart_max, std::vector<int>& remove_list);
+    
+    //! Merges the particles of one cell, given by their indexes
+    virtual void mergeCell(Particles*, std::vector<unsigned int>&, std::vector<int>&) {};
+    
+    //! Sorts the particles ipart_min to ipart_max-1 by cell: indexes are sorted, and cell_start
+    //! contains the position in indexes of the first particle of each cell (plus a last element)
+    void sortByCell(Particles*, unsigned int ipart_min, unsigned int ipart_max,
+                    std::vector<unsigned int>& indexes, std::vector<unsigned int>& cell_start);
+    
+    //! Number of timesteps between two merging operations
+    unsigned int merge_every;
+    
+protected:
+    //! Cells containing less particles than this are not merged
+    unsigned int min_particles_per_cell;
+    
+    //! Number of sub-cells in momentum space in each direction
+    std::vector<unsigned int> momentum_cells;
+    
+    unsigned int nDim_particle;
+    std::vector<double> cell_length_inv;
+
+private:
+    //! Global cell index of a particle in each direction
+    inline void cellOf(Particles* particles, unsigned int ipart, int* cell) {
+        for (unsigned int i=0; i<3; i++)
+            cell[i] = i<nDim_particle ? (int)floor( particles->position(i, ipart)*cell_length_inv[i] ) : 0;
+    }
+
+};
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef MERGINGFACTORY_H
+#define MERGINGFACTORY_H
+
+#include "Merging.h"
+#include "MergingVranic.h"
+
+#include "Params.h"
+
+#include "Tools.h"
+
+#include "Species.h"
+
+//! this class create and associate the right merging method to species
+class MergingFactory {
+public:
+    static Merging* create(Params& params, Species * species) {
+        Merging* Merge = NULL;
+        std::string method=species->merging_method;
+        
+        if ( method == "vranic" ) {
+            Merge = new MergingVranic( params, species );
+        } else if ( method != "none" ) {
+            ERROR( "For species " << species->species_type << ": unknown merging_method `" << method << "`");
+        }
+        return Merge;
+    }
+
+};
+
+#endif
@@ -0,0 +1,140 @@
+#include "MergingVranic.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "Particles.h"
+#include "Species.h"
+
+using namespace std;
+
+
+
+MergingVranic::MergingVranic(Params& params, Species * species) : Merging(params, species) {
+    DEBUG("Creating the Vranic Merging class");
+}
+
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Merge the particles of one cell: the particles are sorted by charge and momentum sub-cell,
+// and each group of more than 2 particles is merged
+// ---------------------------------------------------------------------------------------------------------------------
+void MergingVranic::mergeCell(Particles* particles, vector<unsigned int>& indexes, vector<int>& remove_list) {
+    
+    unsigned int npart = indexes.size();
+    if ( npart < 3 ) return;
+    
+    // Extent of the momentum space in this cell
+    double pmin[3], pmax[3], inv_dp[3];
+    for (unsigned int i=0; i<3; i++) {
+        pmin[i] = particles->momentum(i, indexes[0]);
+        pmax[i] = pmin[i];
+    }
+    for (unsigned int k=1; k<npart; k++) {
+        for (unsigned int i=0; i<3; i++) {
+            double p = particles->momentum(i, indexes[k]);
+            if (p<pmin[i]) pmin[i] = p;
+            if (p>pmax[i]) pmax[i] = p;
+        }
+    }
+    for (unsigned int i=0; i<3; i++)
+        inv_dp[i] = pmax[i]>pmin[i] ? (double)momentum_cells[i]/(pmax[i]-pmin[i]) : 0.;
+    
+    // Sort the particles by charge and momentum sub-cell
+    vector<MergingKey> keys( npart );
+    for (unsigned int k=0; k<npart; k++) {
+        unsigned int ipart = indexes[k];
+        MergingKey& key = keys[k];
+        key.charge = particles->charge(ipart);
+        key.momentum_cell = 0;
+        for (unsigned int i=0; i<3; i++) {
+            unsigned int ic = (particles->momentum(i, ipart)-pmin[i])*inv_dp[i];
+            if (ic>=momentum_cells[i]) ic = momentum_cells[i]-1;
+            key.momentum_cell = key.momentum_cell*momentum_cells[i] + ic;
+        }
+        key.ipart = ipart;
+    }
+    sort( keys.begin(), keys.end() );
+    
+    // Merge the groups
+    unsigned int group_start = 0;
+    while (group_start < npart) {
+        unsigned int group_end = group_start+1;
+        while (group_end<npart && keys[group_end].sameGroup(keys[group_start])) group_end++;
+        if (group_end-group_start > 2)
+            merge( particles, keys, group_start, group_end, remove_list );
+        group_start = group_end;
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Replace a group of particles by two particles of equal weights and energies, with momenta symmetric
+// with respect to the total momentum of the group. The first two particles of the group are kept
+// (with their positions), the others are added to remove_list.
+// ---------------------------------------------------------------------------------------------------------------------
+void MergingVranic::merge( Particles* particles, vector<MergingKey>& keys, unsigned int first, unsigned int last, vector<int>& remove_list) {
+    
+    // Total weight, momentum and kinetic energy of the group
+    double W(0.), P[3]={0.,0.,0.}, K(0.);
+    for (unsigned int k=first; k<last; k++) {
+        unsigned int ipart = keys[k].ipart;
+        double w = particles->weight(ipart);
+        double p2(0.);
+        for (unsigned int i=0; i<3; i++) {
+            double p = particles->momentum(i, ipart);
+            P[i] += w*p;
+            p2   += p*p;
+        }
+        W += w;
+        K += w*p2/(1.+sqrt(1.+p2)); // w*(gamma-1) without cancellation
+    }
+    if (W<=0.) return;
+    
+    // Momentum of the two new particles
+    double k_t = K/W;
+    double p_t = sqrt( k_t*(k_t+2.) );
+    double P_norm = sqrt( P[0]*P[0]+P[1]*P[1]+P[2]*P[2] );
+    
+    // e1 along the total momentum, e2 perpendicular to it
+    double e1[3], e2[3];
+    if (P_norm>0.) {
+        for (unsigned int i=0; i<3; i++) e1[i] = P[i]/P_norm;
+    } else {
+        e1[0] = 1.; e1[1] = 0.; e1[2] = 0.;
+    }
+    unsigned int ip0 = keys[first].ipart;
+    double proj(0.), p0_norm(0.);
+    for (unsigned int i=0; i<3; i++) {
+        proj    += particles->momentum(i, ip0)*e1[i];
+        p0_norm += pow(particles->momentum(i, ip0),2);
+    }
+    for (unsigned int i=0; i<3; i++) e2[i] = particles->momentum(i, ip0) - proj*e1[i];
+    double e2_norm = sqrt( e2[0]*e2[0]+e2[1]*e2[1]+e2[2]*e2[2] );
+    if ( e2_norm <= 1.e-10*sqrt(p0_norm) || e2_norm==0. ) {
+        // First momentum parallel to the total momentum: use the axis the least aligned with e1
+        unsigned int a = 0;
+        for (unsigned int i=1; i<3; i++)
+            if (abs(e1[i])<abs(e1[a])) a = i;
+        for (unsigned int i=0; i<3; i++) e2[i] = -e1[a]*e1[i];
+        e2[a] += 1.;
+        e2_norm = sqrt( e2[0]*e2[0]+e2[1]*e2[1]+e2[2]*e2[2] );
+    }
+    for (unsigned int i=0; i<3; i++) e2[i] /= e2_norm;
+    
+    double cos_w = p_t>0. ? min( P_norm/(W*p_t), 1. ) : 1.;
+    double sin_w = sqrt( 1.-cos_w*cos_w );
+    
+    unsigned int ipa = keys[first  ].ipart;
+    unsigned int ipb = keys[first+1].ipart;
+    for (unsigned int i=0; i<3; i++) {
+        particles->momentum(i, ipa) = p_t*( cos_w*e1[i] + sin_w*e2[i] );
+        particles->momentum(i, ipb) = p_t*( cos_w*e1[i] - sin_w*e2[i] );
+    }
+    particles->weight(ipa) = 0.5*W;
+    particles->weight(ipb) = 0.5*W;
+    
+    for (unsigned int k=first+2; k<last; k++)
+        remove_list.push_back( keys[k].ipart );
+}
@@ -0,0 +1,45 @@
+#ifndef MERGINGVRANIC_H
+#define MERGINGVRANIC_H
+
+#include <vector>
+
+#include "Merging.h"
+#include "Tools.h"
+
+class Particles;
+
+//! Merge the particles of each cell which are close in momentum space (M. Vranic et al., CPC 191 65 (2015))
+//! Each group of particles sharing a cell, a charge and a momentum sub-cell is replaced by two particles
+//! conserving the total weight, momentum and energy of the group.
+class MergingVranic : public Merging
+{
+
+public:
+    //! Constructor for MergingVranic
+    MergingVranic(Params& params, Species * species);
+    
+    //! apply the merging to the particles of one cell
+    void mergeCell(Particles*, std::vector<unsigned int>&, std::vector<int>&) override;
+    
+private:
+    //! Sorting key of a particle: charge and momentum sub-cell
+    struct MergingKey {
+        short charge;
+        unsigned int momentum_cell;
+        unsigned int ipart;
+        bool operator<(const MergingKey& k) const {
+            if (charge!=k.charge) return charge<k.charge;
+            if (momentum_cell!=k.momentum_cell) return momentum_cell<k.momentum_cell;
+            return ipart<k.ipart;
+        }
+        bool sameGroup(const MergingKey& k) const {
+            return charge==k.charge && momentum_cell==k.momentum_cell;
+        }
+    };
+    
+    //! Replace the particles keys[first] to keys[last-1] by two particles
+    void merge( Particles*, std::vector<MergingKey>& keys, unsigned int first, unsigned int last, std::vector<int>& remove_list);
+};
+
+
+#endif
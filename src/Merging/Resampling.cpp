@@ -0,0 +1,127 @@
+#include "Resampling.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "Species.h"
+#include "Patch.h"
+#include "Profile.h"
+#include "Merging.h"
+#include "MergingVranic.h"
+
+using namespace std;
+
+Resampling::Resampling(Params& params, Species * species, Patch* patch) :
+    target(params.n_space),
+    gen(patch->Hindex()),
+    uniform2(-1., 1.)
+{
+    resampling_every = species->resampling_every;
+    targetProfile    = species->resamplingProfile;
+    ceiling          = species->resampling_ceiling;
+    
+    Merge = new MergingVranic(params, species);
+    
+    nDim_particle = params.nDim_particle;
+    cell_length.resize(nDim_particle);
+    cell_length_inv.resize(nDim_particle);
+    for (unsigned int i=0; i<nDim_particle; i++) {
+        cell_length[i] = params.cell_length[i];
+        cell_length_inv[i] = 1./params.cell_length[i];
+    }
+    min_loc.resize(nDim_particle, 0.);
+    
+    new_particles.initialize(0, *species->particles);
+    
+    computeTarget(params, patch);
+}
+
+
+Resampling::~Resampling() {
+    delete Merge;
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Evaluate the target profile at the centers of the cells of the patch
+// Called at the creation of the patch only, outside of the OpenMP loops
+// ---------------------------------------------------------------------------------------------------------------------
+void Resampling::computeTarget(Params& params, Patch* patch) {
+    
+    vector<Field*> xyz(nDim_particle);
+    for (unsigned int idim=0 ; idim<nDim_particle ; idim++) {
+        min_loc[idim] = patch->getDomainLocalMin(idim);
+        xyz[idim] = new Field3D(params.n_space);
+    }
+    
+    vector<double> ijk(3);
+    for (ijk[0]=0; ijk[0]<params.n_space[0]; ijk[0]++)
+        for (ijk[1]=0; ijk[1]<params.n_space[1]; ijk[1]++)
+            for (ijk[2]=0; ijk[2]<params.n_space[2]; ijk[2]++)
+                for (unsigned int idim=0 ; idim<nDim_particle ; idim++)
+                    (*xyz[idim])(ijk[0],ijk[1],ijk[2]) = min_loc[idim] + (ijk[idim]+0.5)*cell_length[idim];
+    
+    targetProfile->valuesAt(xyz, target);
+    
+    for (unsigned int idim=0 ; idim<nDim_particle ; idim++)
+        delete xyz[idim];
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Resample the particles of one bin, cell by cell
+// ---------------------------------------------------------------------------------------------------------------------
+void Resampling::operator() (Particles* particles, unsigned int ipart_min, unsigned int ipart_max, vector<int>& remove_list) {
+    
+    vector<unsigned int> indexes, cell_start, cell_indexes;
+    Merge->sortByCell( particles, ipart_min, ipart_max, indexes, cell_start );
+    
+    for (unsigned int icell=0; icell<cell_start.size()-1; icell++) {
+        unsigned int npart = cell_start[icell+1]-cell_start[icell];
+        
+        // Local cell of the first particle
+        unsigned int ipart = indexes[cell_start[icell]];
+        unsigned int c[3] = {0,0,0};
+        for (unsigned int i=0; i<nDim_particle; i++) {
+            int ci = floor( (particles->position(i, ipart)-min_loc[i])*cell_length_inv[i] );
+            c[i] = min( (unsigned int)max(ci,0), target.dims_[i]-1 );
+        }
+        double n_target = floor( target(c[0],c[1],c[2]) );
+        
+        cell_indexes.assign( indexes.begin()+cell_start[icell], indexes.begin()+cell_start[icell+1] );
+        if ( npart < n_target )
+            split( particles, cell_indexes, min( (unsigned int)n_target-npart, npart ) );
+        else if ( npart > ceiling*n_target )
+            Merge->mergeCell( particles, cell_indexes, remove_list );
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Split the n_split heaviest particles of a cell in two particles of half weight, with the same momentum,
+// displaced symmetrically along each axis (charge, momentum and energy are conserved). The charge barycenter
+// is conserved only along each axis: the shift is bounded by the distance to the closest cell boundary,
+// so that both particles stay in the cell of the original particle.
+// ---------------------------------------------------------------------------------------------------------------------
+void Resampling::split(Particles* particles, vector<unsigned int>& indexes, unsigned int n_split) {
+    
+    struct heavier {
+        Particles* p;
+        bool operator()(unsigned int i, unsigned int j) const { return p->weight(i) > p->weight(j); }
+    } cmp = {particles};
+    partial_sort( indexes.begin(), indexes.begin()+n_split, indexes.end(), cmp );
+    
+    for (unsigned int k=0; k<n_split; k++) {
+        unsigned int ipart = indexes[k];
+        particles->weight(ipart) *= 0.5;
+        particles->cp_particle( ipart, new_particles );
+        unsigned int inew = new_particles.size()-1;
+        for (unsigned int i=0; i<nDim_particle; i++) {
+            double x  = particles->position(i, ipart);
+            double lo = floor( x*cell_length_inv[i] )*cell_length[i];
+            double delta = uniform2(gen) * 0.5 * min( x-lo, lo+cell_length[i]-x );
+            particles->position(i, ipart) = x + delta;
+            new_particles.position(i, inew) = x - delta;
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef RESAMPLING_H
+#define RESAMPLING_H
+
+#include <vector>
+#include <random>
+
+#include "Tools.h"
+#include "Params.h"
+#include "Particles.h"
+#include "Field3D.h"
+
+class Species;
+class Patch;
+class Profile;
+class Merging;
+
+//! Class Resampling: keeps the number of particles per cell close to a target (resampling_ppc profile).
+//! The heaviest particles of the cells containing less particles than the target are split,
+//! and the particles of the cells containing more than resampling_ceiling times the target are merged.
+class Resampling
+{
+
+public:
+    //! Constructor for Resampling (the target is evaluated once, as the patch region does not change)
+    Resampling(Params& params, Species * species, Patch* patch);
+    ~Resampling();
+    
+    //! Resamples the particles ipart_min to ipart_max-1 (one bin): the new particles are appended to
+    //! new_particles, and the indexes of the particles to be removed to remove_list
+    void operator() (Particles*, unsigned int ipart_min, unsigned int ipart_max, std::vector<int>& remove_list);
+    
+    //! Number of timesteps between two resampling operations
+    unsigned int resampling_every;
+    
+    //! Particles created by splitting
+    Particles new_particles;
+    
+private:
+    //! Evaluates the target number of particles in each cell of the patch (calls python: not thread-safe)
+    void computeTarget(Params& params, Patch* patch);
+    
+    //! Splits the n_split heaviest particles of a cell
+    void split(Particles*, std::vector<unsigned int>& indexes, unsigned int n_split);
+    
+    //! Target number of particles per cell
+    Profile* targetProfile;
+    //! Target number of particles in each cell of the patch
+    Field3D target;
+    //! Cells containing more than ceiling*target particles are merged
+    double ceiling;
+    
+    //! Merging method used in the cells containing too many particles
+    Merging* Merge;
+    
+    unsigned int nDim_particle;
+    std::vector<double> cell_length, cell_length_inv;
+    //! Local min of the patch
+    std::vector<double> min_loc;
+    
+    //! Random generator of the patch, seeded by its hindex : the patches are resampled concurrently by the threads,
+    //! which cannot share the global generator Rand::gen
+    std::mt19937 gen;
+    std::uniform_real_distribution<double> uniform2;
+
+};
+
+#endif
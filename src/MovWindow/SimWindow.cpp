@@ -11,6 +11,7 @@
 #include "DiagnosticTrack.h"
 #include "Hilbert_functions.h"
 #include "PatchesFactory.h"
+#include "MemoryPool.h"
 #include <iostream>
 #include <omp.h>
 #include <fstream>
@@ -142,6 +143,7 @@ void SimWindow::operate(VectorPatch& vecPatches, SmileiMPI* smpi, Params& params
     //Creation of new Patches if necessary
     //Use clone instead of create ??
     //These patches are created with correct parameters.
+    //Their fields and particles reuse the memory of the patches deleted at the previous move (see MemoryPool).
     for (unsigned int j=0; j< patch_to_be_created.size(); j++){
     //for (int j=1; j >= 0 ; j--){
         mypatch = PatchesFactory::clone(vecPatches(0),params, smpi, h0 + patch_to_be_created[j], n_moved );
@@ -166,6 +168,8 @@ void SimWindow::operate(VectorPatch& vecPatches, SmileiMPI* smpi, Params& params
         vecPatches.patches_[patch_to_be_created[j]] = mypatch ;
 
     }
+    // Free the memory which was not reused
+    MemoryPool::trim();
 
     //Wait for sends to be completed
     for (unsigned int ipatch = 0 ; ipatch < nPatches ; ipatch++){ 
@@ -230,7 +234,8 @@ void SimWindow::operate(VectorPatch& vecPatches, SmileiMPI* smpi, Params& params
     poynting[0].resize(params.nDim_field,0.0);
     poynting[1].resize(params.nDim_field,0.0);
 
-    //Delete useless patches
+    //Delete useless patches, keeping their memory for the patches created at the next move
+    MemoryPool::startRetaining();
     for (unsigned int j=0; j < delete_patches_.size(); j++){
         mypatch = delete_patches_[j];
 
@@ -247,6 +252,7 @@ void SimWindow::operate(VectorPatch& vecPatches, SmileiMPI* smpi, Params& params
 
         delete  mypatch;
     }
+    MemoryPool::stopRetaining();
 
     vecPatches(0)->EMfields->storeNRJlost( energy_field_lost );
     for ( unsigned int ispec=0 ; ispec<nSpecies ; ispec++ )
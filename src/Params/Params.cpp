@@ -294,6 +294,9 @@ namelist("")
     
     // clrw 
     PyTools::extract("clrw",clrw, "Main");
+    
+    // chunk_size
+    PyTools::extract("chunk_size",chunk_size, "Main");
 
 
         
@@ -138,6 +138,8 @@ public:
     //! Clusters width
     //unsigned int clrw;
     int clrw;
+    //! Number of particles of a bin processed together in Species::dynamics (0 : the whole bin)
+    unsigned int chunk_size;
     //! Number of cells per cluster
     int n_cell_per_patch;
     
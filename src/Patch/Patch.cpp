@@ -414,7 +414,7 @@ void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim,
                 // Then send particles
                 int tag = buildtag( hindex, iDim+1, iNeighbor+3 );
                 vecSpecies[ispec]->typePartSend[(iDim*2)+iNeighbor] = smpi->createMPIparticles( &(vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor]) );
-                MPI_Isend( &((vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor]).position(0,0)), 1, vecSpecies[ispec]->typePartSend[(iDim*2)+iNeighbor], MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]) );
+                MPI_Isend( (vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor]).address(), 1, vecSpecies[ispec]->typePartSend[(iDim*2)+iNeighbor], MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]) );
             }
             else {
                 //If not MPI comm, copy particles directly in the receive buffer
@@ -429,7 +429,7 @@ void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim,
                 // If MPI comm, receive particles in the recv buffer previously initialized.
                 vecSpecies[ispec]->typePartRecv[(iDim*2)+iNeighbor] = smpi->createMPIparticles( &(vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]) );
                 int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+1 ,iNeighbor+3 );
-                MPI_Irecv( &((vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]).position(0,0)), 1, vecSpecies[ispec]->typePartRecv[(iDim*2)+iNeighbor], MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
+                MPI_Irecv( (vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]).address(), 1, vecSpecies[ispec]->typePartRecv[(iDim*2)+iNeighbor], MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
             }
 
         } // END of Recv
@@ -570,11 +570,8 @@ void Patch::finalizeCommParticles(SmileiMPI* smpi, int ispec, Params& params, in
             shift[j]+=shift[j-1];
         }
         //Make room for new particles
-        if (shift[(*cubmax).size()]) {
-          //! vecor::resize of Charge crashed ! Temporay solution : push_back / Particle
-          //cuParticles.initialize( cuParticles.size()+shift[(*cubmax).size()], cuParticles.Position.size() );
-          for (int inewpart=0 ; inewpart<shift[(*cubmax).size()] ; inewpart++) cuParticles.create_particle();
-        }
+        if (shift[(*cubmax).size()])
+            cuParticles.create_particles( shift[(*cubmax).size()] );
             
         //Shift bins, must be done sequentially
         for (unsigned int j=(*cubmax).size()-1; j>=1; j--){
@@ -639,6 +636,54 @@ void Patch::cleanParticlesOverhead(Params& params)
 
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Fields of the patch holding data (the unused species fields are deleted by VectorPatch::createDiags)
+// ---------------------------------------------------------------------------------------------------------------------
+static vector<Field*> allocatedFields( ElectroMagn* EMfields )
+{
+    Field* fields[] = { EMfields->Ex_, EMfields->Ey_, EMfields->Ez_, EMfields->Bx_, EMfields->By_, EMfields->Bz_,
+                        EMfields->Bx_m, EMfields->By_m, EMfields->Bz_m, EMfields->Jx_, EMfields->Jy_, EMfields->Jz_, EMfields->rho_ };
+    vector<Field*> list( fields, fields + sizeof(fields)/sizeof(Field*) );
+    
+    for (unsigned int ispec=0 ; ispec<EMfields->Jx_s.size() ; ispec++) {
+        if (EMfields->Jx_s [ispec]) list.push_back( EMfields->Jx_s [ispec] );
+        if (EMfields->Jy_s [ispec]) list.push_back( EMfields->Jy_s [ispec] );
+        if (EMfields->Jz_s [ispec]) list.push_back( EMfields->Jz_s [ispec] );
+        if (EMfields->rho_s[ispec]) list.push_back( EMfields->rho_s[ispec] );
+    }
+    
+    for (unsigned int idiag=0 ; idiag<EMfields->allFields_avg.size() ; idiag++)
+        list.insert( list.end(), EMfields->allFields_avg[idiag].begin(), EMfields->allFields_avg[idiag].end() );
+    
+    return list;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Reallocate fields and particles from the calling thread : with the first touch policy, their pages are placed on
+// the NUMA node of the thread which will then process this patch
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::firstTouch()
+{
+    vector<Field*> fields = allocatedFields( EMfields );
+    for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++)
+        fields[ifield]->firstTouch();
+    
+    for (unsigned int ispec=0 ; ispec<vecSpecies.size() ; ispec++)
+        vecSpecies[ispec]->particles->firstTouch();
+}
+
+void Patch::countPagesPerNumaNode(std::vector<unsigned int>& pages)
+{
+    vector<Field*> fields = allocatedFields( EMfields );
+    for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++)
+        Tools::countPagesPerNumaNode( fields[ifield]->data_, fields[ifield]->globalDims_*sizeof(double), pages );
+    
+    for (unsigned int ispec=0 ; ispec<vecSpecies.size() ; ispec++) {
+        Particles* particles = vecSpecies[ispec]->particles;
+        Tools::countPagesPerNumaNode( particles->address(), particles->capacity()*particles->bytes_per_particle(), pages );
+    }
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Clear vecSpecies[]->indexes_of_particles_to_exchange, suppress particles send and manage memory
 // ---------------------------------------------------------------------------------------------------------------------
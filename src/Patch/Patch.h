@@ -97,6 +97,10 @@ public:
     void finalizeCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch* vecPatch);
     //! clean memory resizing particles structure
     void cleanParticlesOverhead(Params& params);
+    //! reallocate fields and particles from the calling thread, to place them on its NUMA node (first touch)
+    void firstTouch();
+    //! count the memory pages of fields and particles located on each NUMA node
+    void countPagesPerNumaNode(std::vector<unsigned int>& pages);
     //! delete Particles included in the index of particles to exchange. Assumes indexes are sorted.
     void cleanup_sent_particles(int ispec, std::vector<int>* indexes_of_particles_to_exchange);
     
@@ -84,6 +84,10 @@ public:
         vecPatches.initExternals( params );
         
         MESSAGE(1,"Done initializing diagnostics");
+        
+        // Patches were created by the master thread : move their memory to the threads in charge of them
+        vecPatches.firstTouch( smpi );
+        
         return vecPatches;
     }
 
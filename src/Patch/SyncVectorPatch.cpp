@@ -11,10 +11,8 @@ using namespace std;
 
 void SyncVectorPatch::exchangeParticles(VectorPatch& vecPatches, int ispec, Params &params, SmileiMPI* smpi, Timers &timers, int itime)
 {
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-        vecPatches(ipatch)->initExchParticles(smpi, ispec, params);
-    }
+    // The particles to exchange were already sorted per direction by Patch::initExchParticles,
+    // at the end of the dynamics of each patch (see VectorPatch::dynamics)
     
     // Per direction
     for (unsigned int iDim=0 ; iDim<1 ; iDim++) {
@@ -72,9 +70,20 @@ void SyncVectorPatch::finalize_and_sort_parts(VectorPatch& vecPatches, int ispec
 //        vecPatches(ipatch)->injectParticles(smpi, ispec, params, params.nDim_particle-1, &vecPatches); // wait
     
     
+    // The sort loop lies between the implicit barriers of the omp for loops : no additional barrier to time it
+    timers.sort[ispec].restartNoBarrier();
     #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++)
-        vecPatches(ipatch)->vecSpecies[ispec]->sort_part();
+    for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
+        Species* spec = vecPatches(ipatch)->vecSpecies[ispec];
+        spec->sort_part();
+        spec->mergeParticles(itime);
+        spec->resampleParticles(itime, params, vecPatches(ipatch), vecPatches.localDiags);
+        if (spec->sort_mode!="bin" && spec->count_sort_part(params)) {
+            #pragma omp atomic
+            timers.sort_count[ispec]++;
+        }
+    }
+    timers.sort[ispec].updateNoBarrier();
 }
 
 
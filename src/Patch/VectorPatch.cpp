@@ -4,8 +4,12 @@
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include <sstream>
 #include <cstring>
 //#include <string>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "Collisions.h"
 #include "Hilbert_functions.h"
@@ -99,22 +103,33 @@ void VectorPatch::dynamics(Params& params, SmileiMPI* smpi, SimWindow* simWindow
 {
     
     #pragma omp single
-    diag_flag = needsRhoJsNow(itime);
+    {
+        diag_flag = needsRhoJsNow(itime);
+        if( diag_flag ) flagRhoJsNow(itime);
+    }
     
     timers.particles.restart();
-    ostringstream t;
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
+    // Each patch goes through all the patch-local work : particle dynamics, sum of the species densities and
+    // selection of the particles to exchange. No patch waits for the others in between.
+    // The patches are statically assigned to the threads, as in VectorPatch::firstTouch : each thread works on the
+    // memory it placed on its own NUMA node (load imbalance between patches is left to the load balancing)
+    #pragma omp for schedule(static)
+    for (unsigned int ipatch=0 ; ipatch<size() ; ipatch++) {
         (*this)(ipatch)->EMfields->restartRhoJ();
+        // The species deposit in their own densities only if a diagnostic requires them now
+        if( diag_flag ) (*this)(ipatch)->EMfields->selectRhoJs( fields_needed );
         for (unsigned int ispec=0 ; ispec<(*this)(ipatch)->vecSpecies.size() ; ispec++) {
             if ( (*this)(ipatch)->vecSpecies[ispec]->isProj(time_dual, simWindow) || diag_flag  ) {
-                species(ipatch, ispec)->dynamics(time_dual, ispec,
+                species(ipatch, ispec)->dynamics(time_dual, itime, ispec,
                                                  emfields(ipatch), interp(ipatch), proj(ipatch),
                                                  params, diag_flag, partwalls(ipatch),
                                                  (*this)(ipatch), smpi, localDiags);
             }
+            if ( (*this)(ipatch)->vecSpecies[ispec]->isProj(time_dual, simWindow) )
+                (*this)(ipatch)->initExchParticles(smpi, ispec, params);
         }
-    
+        // Add the species densities to the total ones (before the synchronization in sumDensities)
+        if( diag_flag ) (*this)(ipatch)->EMfields->computeTotalRhoJ();
     }
     timers.particles.update( params.printNow( itime ) );
 
@@ -185,16 +200,7 @@ void VectorPatch::sumDensities(Params &params, double time_dual, Timers &timers,
         return;
 
 
-    timers.densities.restart();
-    if  (diag_flag){
-        #pragma omp for schedule(static)
-        for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
-             // Per species in global, Attention if output -> Sync / per species fields
-            (*this)(ipatch)->EMfields->computeTotalRhoJ();
-        }
-    }
-    timers.densities.update();
-    
+    // The species densities were added to the total ones at the end of each patch dynamics
     timers.syncDens.restart();
     SyncVectorPatch::sumRhoJ( (*this), timers, itime ); // MPI
     
@@ -639,6 +645,67 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI* smpi )
 } // END solvePoisson
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Place the memory of each patch on the NUMA node of the thread in charge of it : patches are distributed among the
+// threads with the static schedule of the field solvers, and each thread reallocates the fields and particles of its
+// patches (first touch policy). Patches being created by the master thread, they would all be on its node otherwise.
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::firstTouch(SmileiMPI* smpi)
+{
+    int nthds(1);
+#ifdef _OPENMP
+    nthds = omp_get_max_threads();
+#endif
+    // NUMA node of each thread, and number of pages of its patches on each NUMA node
+    vector<int> thread_node( nthds, -1 );
+    vector<vector<unsigned int> > thread_pages( nthds );
+    
+    #pragma omp parallel
+    {
+        int ithread(0);
+#ifdef _OPENMP
+        ithread = omp_get_thread_num();
+#endif
+        #pragma omp for schedule(static)
+        for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+            (*this)(ipatch)->firstTouch();
+        
+        thread_node[ithread] = Tools::numaNodeOfThread();
+        #pragma omp for schedule(static)
+        for (unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++)
+            (*this)(ipatch)->countPagesPerNumaNode( thread_pages[ithread] );
+    }
+    
+    // Pinning report : pages located on the NUMA node of the thread in charge of them, for all MPI processes
+    unsigned long pages[2] = {0, 0}, all_pages[2] = {0, 0};
+    for (int ithread=0 ; ithread<nthds ; ithread++)
+        for (unsigned int inode=0 ; inode<thread_pages[ithread].size() ; inode++) {
+            pages[0] += thread_pages[ithread][inode];
+            if ( (int)inode == thread_node[ithread] )
+                pages[1] += thread_pages[ithread][inode];
+        }
+    MPI_Reduce( pages, all_pages, 2, MPI_UNSIGNED_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+    
+    if (smpi->isMaster()) {
+        TITLE("Memory placement (first touch)");
+        if ( all_pages[0] == 0 ) {
+            MESSAGE(1,"NUMA placement of the memory cannot be queried on this system");
+        } else {
+            ostringstream nodes("");
+            for (int ithread=0 ; ithread<nthds ; ithread++)
+                nodes << " " << thread_node[ithread];
+            MESSAGE(1,"NUMA node of each thread (process 0) :" << nodes.str() );
+            MESSAGE(1,"Fields and particles on the NUMA node of their thread : " << fixed << setprecision(1)
+                    << 100.*(double)all_pages[1]/(double)all_pages[0] << "% of " << all_pages[0] << " pages" );
+        }
+#ifdef _OPENMP
+        if ( omp_get_proc_bind() == omp_proc_bind_false )
+            WARNING("Threads are not bound to cores (see OMP_PROC_BIND) : the memory placement may not be kept");
+#endif
+    }
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // ---------------------------------------------------------------------------------------------------------------------
 // ----------------------------------------------    BALANCING METHODS    ----------------------------------------------
@@ -1080,36 +1147,36 @@ void VectorPatch::update_field_list(int ispec)
     #pragma omp barrier
     #pragma omp single
     {
-        if(patches_[0]->EMfields->Jx_s [ispec]) listJxs_.resize( size() ) ;
+        if(patches_[0]->EMfields->Jx_s_now [ispec]) listJxs_.resize( size() ) ;
         else
             listJxs_.clear();
-        if(patches_[0]->EMfields->Jy_s [ispec]) listJys_.resize( size() ) ;
+        if(patches_[0]->EMfields->Jy_s_now [ispec]) listJys_.resize( size() ) ;
         else
             listJys_.clear();
-        if(patches_[0]->EMfields->Jz_s [ispec]) listJzs_.resize( size() ) ;
+        if(patches_[0]->EMfields->Jz_s_now [ispec]) listJzs_.resize( size() ) ;
         else
             listJzs_.clear();
-        if(patches_[0]->EMfields->rho_s[ispec]) listrhos_.resize( size() ) ;
+        if(patches_[0]->EMfields->rho_s_now[ispec]) listrhos_.resize( size() ) ;
         else
             listrhos_.clear();
     }
     
     #pragma omp for schedule(static)
     for (unsigned int ipatch=0 ; ipatch < size() ; ipatch++) {
-        if(patches_[ipatch]->EMfields->Jx_s [ispec]) {
-            listJxs_ [ipatch] = patches_[ipatch]->EMfields->Jx_s [ispec];
+        if(patches_[ipatch]->EMfields->Jx_s_now [ispec]) {
+            listJxs_ [ipatch] = patches_[ipatch]->EMfields->Jx_s_now [ispec];
             listJxs_ [ipatch]->MPIbuff.defineTags( patches_[ipatch], 0 );
         }
-        if(patches_[ipatch]->EMfields->Jy_s [ispec]) {
-            listJys_ [ipatch] = patches_[ipatch]->EMfields->Jy_s [ispec];
+        if(patches_[ipatch]->EMfields->Jy_s_now [ispec]) {
+            listJys_ [ipatch] = patches_[ipatch]->EMfields->Jy_s_now [ispec];
             listJys_ [ipatch]->MPIbuff.defineTags( patches_[ipatch], 0 );
         }
-        if(patches_[ipatch]->EMfields->Jz_s [ispec]) {
-            listJzs_ [ipatch] = patches_[ipatch]->EMfields->Jz_s [ispec];
+        if(patches_[ipatch]->EMfields->Jz_s_now [ispec]) {
+            listJzs_ [ipatch] = patches_[ipatch]->EMfields->Jz_s_now [ispec];
             listJzs_ [ipatch]->MPIbuff.defineTags( patches_[ipatch], 0 );
         }
-        if(patches_[ipatch]->EMfields->rho_s[ispec]) {
-            listrhos_[ipatch] = patches_[ipatch]->EMfields->rho_s[ispec];
+        if(patches_[ipatch]->EMfields->rho_s_now[ispec]) {
+            listrhos_[ipatch] = patches_[ipatch]->EMfields->rho_s_now[ispec];
             listrhos_[ipatch]->MPIbuff.defineTags( patches_[ipatch], 0 );
         }
     }
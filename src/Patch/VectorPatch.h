@@ -83,6 +83,13 @@ public :
         return false;
     }
     
+    //! Flags the fields of ElectroMagn::allFields required by the diagnostics at this timestep
+    void flagRhoJsNow( int timestep ) {
+        fields_needed.assign( (*this)(0)->EMfields->allFields.size(), false );
+        for( unsigned int i=0; i<localDiags.size(); i++ )
+            localDiags[i]->flagRhoJs( timestep, fields_needed );
+    }
+    
     // Interfaces between main programs & main PIC operators
     // -----------------------------------------------------
     
@@ -117,6 +124,9 @@ public :
     //! For all patch initialize the externals (lasers, fields, antennas)
     void initExternals(Params& params);
     
+    //! Place the memory of each patch on the NUMA node of the thread in charge of it, and report the placement
+    void firstTouch(SmileiMPI* smpi);
+    
     //! For all patches, apply the antenna current
     void applyAntennas(double time);
     
@@ -211,6 +221,8 @@ public :
     
     // Keep track if we need the needsRhoJsNow
     int diag_flag;
+    //! Fields of ElectroMagn::allFields required by the diagnostics at the current timestep (see flagRhoJsNow)
+    std::vector<bool> fields_needed;
     
     int nrequests;
     
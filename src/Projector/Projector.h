@@ -10,6 +10,7 @@ class Patch;
 class ElectroMagn;
 class Field;
 class Particles;
+template<typename real> class ParticleArrays;
 
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -9,9 +9,11 @@ public:
     ~Projector1D4Order();
 
     //! Project global current densities (EMfields->Jx_/Jy_/Jz_)
-    inline void operator() (double* Jx, double* Jy, double* Jz, Particles &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* delta);
+    template<typename real>
+    inline void operator() (double* Jx, double* Jy, double* Jz, const ParticleArrays<real> &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* delta);
     //! Project global current densities (EMfields->Jx_/Jy_/Jz_/rho), diagFields timestep
-    inline void operator() (double* Jx, double* Jy, double* Jz, double* rho, Particles &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* delta);
+    template<typename real>
+    inline void operator() (double* Jx, double* Jy, double* Jz, double* rho, const ParticleArrays<real> &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* delta);
 
     //! Project global current charge (EMfields->rho_), frozen & diagFields timestep
     void operator() (double* rho, Particles &particles, unsigned int ipart, unsigned int bin, std::vector<unsigned int> &b_dim) override final;
@@ -23,6 +25,10 @@ public:
     void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, bool diag_flag, std::vector<unsigned int> &b_dim, int ispec) override final;
 
 private:
+    //! Body of the wrapper, for particles stored in precision real
+    template<typename real>
+    void currents(ElectroMagn* EMfields, const ParticleArrays<real> &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, bool diag_flag, std::vector<unsigned int> &b_dim, int ispec);
+
     double dx_ov_dt;
     double dble_1_ov_384 ;
     double dble_1_ov_48 ;
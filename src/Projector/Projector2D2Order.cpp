@@ -43,7 +43,8 @@ Projector2D2Order::~Projector2D2Order()
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project current densities : main projector
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D2Order::operator() (double* Jx, double* Jy, double* Jz, Particles &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold)
+template<typename real>
+void Projector2D2Order::operator() (double* Jx, double* Jy, double* Jz, const ParticleArrays<real> &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold)
 {
     
     // -------------------------------------
@@ -171,7 +172,8 @@ void Projector2D2Order::operator() (double* Jx, double* Jy, double* Jz, Particle
 // ---------------------------------------------------------------------------------------------------------------------
 //!  Project current densities & charge : diagFields timstep
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D2Order::operator() (double* Jx, double* Jy, double* Jz, double* rho, Particles &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold)
+template<typename real>
+void Projector2D2Order::operator() (double* Jx, double* Jy, double* Jz, double* rho, const ParticleArrays<real> &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold)
 {
     
     // -------------------------------------
@@ -307,7 +309,7 @@ void Projector2D2Order::operator() (double* Jx, double* Jy, double* Jz, double*
 // ---------------------------------------------------------------------------------------------------------------------
 void Projector2D2Order::operator() (double* rho, Particles &particles, unsigned int ipart, unsigned int bin, std::vector<unsigned int> &b_dim)
 {
-    //Warning : this function is used for frozen species only. It is assumed that position = position_old !!!
+    //Warning : this function is used for frozen species only. The particle does not move, so only its current position is used !!!
     
     // -------------------------------------
     // Variable declaration & initialization
@@ -452,7 +454,8 @@ void Projector2D2Order::operator() (Field* Jx, Field* Jy, Field* Jz, Particles &
 // ---------------------------------------------------------------------------------------------------------------------
 //! Wrapper for projection
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D2Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, bool diag_flag, std::vector<unsigned int> &b_dim, int ispec)
+template<typename real>
+void Projector2D2Order::currents(ElectroMagn* EMfields, const ParticleArrays<real> &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, bool diag_flag, std::vector<unsigned int> &b_dim, int ispec)
 {
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
@@ -470,11 +473,19 @@ void Projector2D2Order::operator() (ElectroMagn* EMfields, Particles &particles,
             
     // Otherwise, the projection may apply to the species-specific arrays
     } else {
-        double* b_Jx  = EMfields->Jx_s [ispec] ? &(*EMfields->Jx_s [ispec])(ibin*clrw* dim1   ) : &(*EMfields->Jx_ )(ibin*clrw* dim1   ) ;
-        double* b_Jy  = EMfields->Jy_s [ispec] ? &(*EMfields->Jy_s [ispec])(ibin*clrw*(dim1+1)) : &(*EMfields->Jy_ )(ibin*clrw*(dim1+1)) ;
-        double* b_Jz  = EMfields->Jz_s [ispec] ? &(*EMfields->Jz_s [ispec])(ibin*clrw* dim1   ) : &(*EMfields->Jz_ )(ibin*clrw* dim1   ) ;
-        double* b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(ibin*clrw* dim1   ) : &(*EMfields->rho_)(ibin*clrw* dim1   ) ;
+        double* b_Jx  = EMfields->Jx_s_now [ispec] ? &(*EMfields->Jx_s_now [ispec])(ibin*clrw* dim1   ) : &(*EMfields->Jx_ )(ibin*clrw* dim1   ) ;
+        double* b_Jy  = EMfields->Jy_s_now [ispec] ? &(*EMfields->Jy_s_now [ispec])(ibin*clrw*(dim1+1)) : &(*EMfields->Jy_ )(ibin*clrw*(dim1+1)) ;
+        double* b_Jz  = EMfields->Jz_s_now [ispec] ? &(*EMfields->Jz_s_now [ispec])(ibin*clrw* dim1   ) : &(*EMfields->Jz_ )(ibin*clrw* dim1   ) ;
+        double* b_rho = EMfields->rho_s_now[ispec] ? &(*EMfields->rho_s_now[ispec])(ibin*clrw* dim1   ) : &(*EMfields->rho_)(ibin*clrw* dim1   ) ;
         for (int ipart=istart ; ipart<iend; ipart++ )
             (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[2*ipart], &(*delta)[2*ipart]);
     }
 }
+
+void Projector2D2Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, bool diag_flag, std::vector<unsigned int> &b_dim, int ispec)
+{
+    if (particles.singlePrecision)
+        currents(EMfields, ParticleArrays<float >(particles), smpi, istart, iend, ithread, ibin, clrw, diag_flag, b_dim, ispec);
+    else
+        currents(EMfields, ParticleArrays<double>(particles), smpi, istart, iend, ithread, ibin, clrw, diag_flag, b_dim, ispec);
+}
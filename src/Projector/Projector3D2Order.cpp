@@ -11,6 +11,8 @@
 
 using namespace std;
 
+const int Projector3D2Order::block_size;
+
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Constructor for Projector3D2Order
@@ -44,339 +46,211 @@ Projector3D2Order::~Projector3D2Order()
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-//! Project local currents (sort)
+//! Esirkepov coefficients of the np particles of a block, stored by node : S0[i*block_size+ipart], i=0..4
+//! S0 at the former position (distance delta0 to the former primal node), DS = S1-S0 where S1 is centered at the new
+//! primal node, shifted by shift (-1, 0 or 1) nodes from the former one
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector3D2Order::operator() (double* Jx, double* Jy, double* Jz, Particles &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold)
+void Projector3D2Order::blockCoeffs( const double* delta0, const double* delta1, const int* shift, double* S0, double* DS, int np )
 {
-
-    // -------------------------------------
-    // Variable declaration & initialization
-    // -------------------------------------
-    
-    // (x,y,z) components of the current density for the macro-particle
-    double charge_weight = (double)(particles.charge(ipart))*particles.weight(ipart);
-    double crx_p = charge_weight*dx_ov_dt;
-    double cry_p = charge_weight*dy_ov_dt;
-    double crz_p = charge_weight*dz_ov_dt;
-    
-    // variable declaration
-    double xpn, ypn, zpn;
-    double delta, delta2;
-    // arrays used for the Esirkepov projection method
-    double Sx0[5], Sx1[5], Sy0[5], Sy1[5], Sz0[5], Sz1[5], DSx[5], DSy[5], DSz[5];
-    double tmpJx[5][5], tmpJy[5][5], tmpJz[5][5];
-    
-    for (unsigned int i=0; i<5; i++) {
-        Sx1[i] = 0.;
-        Sy1[i] = 0.;
-        Sz1[i] = 0.;
-    }
-    for (unsigned int j=0; j<5; j++)
-        for (unsigned int k=0; k<5; k++)
-            tmpJx[j][k] = 0.;
-    for (unsigned int i=0; i<5; i++)
-        for (unsigned int k=0; k<5; k++)
-            tmpJy[i][k] = 0.;
-    for (unsigned int i=0; i<5; i++)
-        for (unsigned int j=0; j<5; j++)
-            tmpJz[i][j] = 0.;
-    
-    // --------------------------------------------------------
-    // Locate particles & Calculate Esirkepov coef. S, DS and W
-    // --------------------------------------------------------
-    
-    // locate the particle on the primal grid at former time-step & calculate coeff. S0
-    delta = *deltaold;
-    delta2 = delta*delta;
-    Sx0[0] = 0.;
-    Sx0[1] = 0.5 * (delta2-delta+0.25);
-    Sx0[2] = 0.75-delta2;
-    Sx0[3] = 0.5 * (delta2+delta+0.25);
-    Sx0[4] = 0.;
-    
-    delta = *(deltaold+1);
-    delta2 = delta*delta;
-    Sy0[0] = 0.;
-    Sy0[1] = 0.5 * (delta2-delta+0.25);
-    Sy0[2] = 0.75-delta2;
-    Sy0[3] = 0.5 * (delta2+delta+0.25);
-    Sy0[4] = 0.;
-    
-    delta = *(deltaold+2);
-    delta2 = delta*delta;
-    Sz0[0] = 0.;
-    Sz0[1] = 0.5 * (delta2-delta+0.25);
-    Sz0[2] = 0.75-delta2;
-    Sz0[3] = 0.5 * (delta2+delta+0.25);
-    Sz0[4] = 0.;
-    
-    // locate the particle on the primal grid at current time-step & calculate coeff. S1
-    xpn = particles.position(0, ipart) * dx_inv_;
-    int ip = round(xpn);
-    int ipo = *iold;
-    int ip_m_ipo = ip-ipo-i_domain_begin;
-    delta  = xpn - (double)ip;
-    delta2 = delta*delta;
-    Sx1[ip_m_ipo+1] = 0.5 * (delta2-delta+0.25);
-    Sx1[ip_m_ipo+2] = 0.75-delta2;
-    Sx1[ip_m_ipo+3] = 0.5 * (delta2+delta+0.25);
-    
-    ypn = particles.position(1, ipart) * dy_inv_;
-    int jp = round(ypn);
-    int jpo = *(iold+1);
-    int jp_m_jpo = jp-jpo-j_domain_begin;
-    delta  = ypn - (double)jp;
-    delta2 = delta*delta;
-    Sy1[jp_m_jpo+1] = 0.5 * (delta2-delta+0.25);
-    Sy1[jp_m_jpo+2] = 0.75-delta2;
-    Sy1[jp_m_jpo+3] = 0.5 * (delta2+delta+0.25);
-    
-    zpn = particles.position(2, ipart) * dz_inv_;
-    int kp = round(zpn);
-    int kpo = *(iold+2);
-    int kp_m_kpo = kp-kpo-k_domain_begin;
-    delta  = zpn - (double)kp;
-    delta2 = delta*delta;
-    Sz1[kp_m_kpo+1] = 0.5 * (delta2-delta+0.25);
-    Sz1[kp_m_kpo+2] = 0.75-delta2;
-    Sz1[kp_m_kpo+3] = 0.5 * (delta2+delta+0.25);
-    
-    // computes Esirkepov coefficients
-    for (unsigned int i=0; i < 5; i++) {
-        DSx[i] = Sx1[i] - Sx0[i];
-        DSy[i] = Sy1[i] - Sy0[i];
-        DSz[i] = Sz1[i] - Sz0[i];
+    #pragma omp simd
+    for ( int ipart=0 ; ipart<np ; ipart++ ) {
+        double delta  = delta0[ipart];
+        double delta2 = delta*delta;
+        double S0m = 0.5 * (delta2-delta+0.25);
+        double S00 = 0.75-delta2;
+        double S0p = 0.5 * (delta2+delta+0.25);
+        
+        delta  = delta1[ipart];
+        delta2 = delta*delta;
+        double S1m = 0.5 * (delta2-delta+0.25);
+        double S10 = 0.75-delta2;
+        double S1p = 0.5 * (delta2+delta+0.25);
+        
+        int sh = shift[ipart];
+        for ( int i=0 ; i<5 ; i++ ) {
+            double S0i = ( i==1 ? S0m : 0. ) + ( i==2 ? S00 : 0. ) + ( i==3 ? S0p : 0. );
+            double S1i = ( i==sh+1 ? S1m : 0. ) + ( i==sh+2 ? S10 : 0. ) + ( i==sh+3 ? S1p : 0. );
+            S0[i*block_size+ipart] = S0i;
+            DS[i*block_size+ipart] = S1i - S0i;
+        }
     }
-    
-    // ---------------------------
-    // Calculate the total current
-    // ---------------------------
-    
-    ipo -= bin+2;   //This minus 2 come from the order 2 scheme, based on a 5 points stencil from -2 to +2.
-    // i/j/kpo stored with - i/j/k_domain_begin in Interpolator
-    jpo -= 2;
-    kpo -= 2;
-    
-    int iloc, jloc, kloc, linindex;
+}
 
-    // Jx^(d,p,p)
-    for (unsigned int i=1 ; i<5 ; i++) {
-        iloc = i+ipo;
-        for (unsigned int j=0 ; j<5 ; j++) {
-            jloc = j+jpo;
-            for (unsigned int k=0 ; k<5 ; k++) {
-                tmpJx[j][k] -= crx_p * DSx[i-1] * (Sy0[j]*Sz0[k] + 0.5*DSy[j]*Sz0[k] + 0.5*DSz[k]*Sy0[j] + one_third*DSy[j]*DSz[k]);
-                kloc = k+kpo;
-                linindex = iloc*b_dim[2]*b_dim[1]+jloc*b_dim[2]+kloc;
-                Jx [linindex] += tmpJx[j][k]; // iloc = (i+ipo)*b_dim[1];
-            }
-        }
-    }//i
-    
-    // Jy^(p,d,p)
-    for (unsigned int i=0 ; i<5 ; i++) {
-        iloc = i+ipo;
-        for (unsigned int j=1 ; j<5 ; j++) {
-            jloc = j+jpo;
-            for (unsigned int k=0 ; k<5 ; k++) {
-                tmpJy[i][k] -= cry_p * DSy[j-1] * (Sz0[k]*Sx0[i] + 0.5*DSz[k]*Sx0[i] + 0.5*DSx[i]*Sz0[k] + one_third*DSz[k]*DSx[i]);
-                kloc = k+kpo;
-                linindex = iloc*b_dim[2]*(b_dim[1]+1)+jloc*b_dim[2]+kloc;
-                Jy [linindex] += tmpJy[i][k]; //
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Add the stencils of the np particles of a block, bJ[((i*nj+j)*nk+k)*block_size+ipart], to the bin array J
+//! (strides sx and sy), at the nodes (ipo+i0+i, jpo+j0+j, kpo+k0+k). When all the particles have the same former
+//! nodes (particles sorted by cell), the block is reduced first and the stencil is added once.
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector3D2Order::addBlock( double* J, const double* bJ, int ni, int nj, int nk, int i0, int j0, int k0, int sx, int sy,
+                                  const int* ipo, const int* jpo, const int* kpo, int np, bool same_nodes )
+{
+    if ( same_nodes ) {
+        double* Jloc = J + (ipo[0]+i0)*sx + (jpo[0]+j0)*sy + kpo[0]+k0;
+        for ( int i=0 ; i<ni ; i++ ) {
+            for ( int j=0 ; j<nj ; j++ ) {
+                for ( int k=0 ; k<nk ; k++ ) {
+                    const double* b = bJ + ((i*nj+j)*nk+k)*block_size;
+                    double sum = 0.;
+                    #pragma omp simd reduction(+:sum)
+                    for ( int ipart=0 ; ipart<np ; ipart++ )
+                        sum += b[ipart];
+                    Jloc[i*sx+j*sy+k] += sum;
+                }
             }
         }
-    }//i
-    
-    // Jz^(p,p,d)
-    for (unsigned int i=0 ; i<5 ; i++) {
-        iloc = i+ipo;
-        for (unsigned int j=0 ; j<5 ; j++) {
-            jloc = j+jpo;
-            for (unsigned int k=1 ; k<5 ; k++) {
-                tmpJz[i][j] -= crz_p * DSz[k-1] * (Sx0[i]*Sy0[j] + 0.5*DSx[i]*Sy0[j] + 0.5*DSy[j]*Sx0[i] + one_third*DSx[i]*DSy[j]);
-                kloc = k+kpo;
-                linindex = iloc*(b_dim[2]+1)*b_dim[1]+jloc*(b_dim[2]+1)+kloc;
-                Jz [linindex] += tmpJz[i][j]; //
-            }
+    } else {
+        for ( int ipart=0 ; ipart<np ; ipart++ ) {
+            double* Jloc = J + (ipo[ipart]+i0)*sx + (jpo[ipart]+j0)*sy + kpo[ipart]+k0;
+            for ( int i=0 ; i<ni ; i++ )
+                for ( int j=0 ; j<nj ; j++ )
+                    for ( int k=0 ; k<nk ; k++ )
+                        Jloc[i*sx+j*sy+k] += bJ[((i*nj+j)*nk+k)*block_size+ipart];
         }
-    }//i
-    
-    
-} // END Project local current densities (Jx, Jy, Jz, sort)
+    }
+}
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-//! Project local current densities (sort)
+//! Project local currents (and the charge if rho is not NULL) of the particles istart to iend-1 of the bin (sort)
+//! The particles are projected by blocks of block_size : the Esirkepov coefficients and the contribution of each
+//! particle to each node of its stencil are computed with vectorized loops on the particles of the block, in SoA
+//! thread-private buffers, then added to the bin arrays
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector3D2Order::operator() (double* Jx, double* Jy, double* Jz, double* rho, Particles &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold)
+template<typename real>
+void Projector3D2Order::currents( double* Jx, double* Jy, double* Jz, double* rho, const ParticleArrays<real> &particles, int istart, int iend,
+                                  unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold )
 {
-
-    // -------------------------------------
-    // Variable declaration & initialization
-    // -------------------------------------
-    
-    // (x,y,z) components of the current density for the macro-particle
-    double charge_weight = (double)(particles.charge(ipart))*particles.weight(ipart);
-    double crx_p = charge_weight*dx_ov_dt;
-    double cry_p = charge_weight*dy_ov_dt;
-    double crz_p = charge_weight*dz_ov_dt;
-    
-    // variable declaration
-    double xpn, ypn, zpn;
-    double delta, delta2;
-    // arrays used for the Esirkepov projection method
-    double Sx0[5], Sx1[5], Sy0[5], Sy1[5], Sz0[5], Sz1[5], DSx[5], DSy[5], DSz[5];
-    double tmpJx[5][5], tmpJy[5][5], tmpJz[5][5];
-    
-    for (unsigned int i=0; i<5; i++) {
-        Sx1[i] = 0.;
-        Sy1[i] = 0.;
-        Sz1[i] = 0.;
-    }
-    
-    for (unsigned int j=0; j<5; j++)
-        for (unsigned int k=0; k<5; k++)
-            tmpJx[j][k] = 0.;
-    for (unsigned int i=0; i<5; i++)
-        for (unsigned int k=0; k<5; k++)
-            tmpJy[i][k] = 0.;
-    for (unsigned int i=0; i<5; i++)
-        for (unsigned int j=0; j<5; j++)
-            tmpJz[i][j] = 0.;
-    // --------------------------------------------------------
-    // Locate particles & Calculate Esirkepov coef. S, DS and W
-    // --------------------------------------------------------
-    
-    // locate the particle on the primal grid at former time-step & calculate coeff. S0
-    delta = *deltaold;
-    delta2 = delta*delta;
-    Sx0[0] = 0.;
-    Sx0[1] = 0.5 * (delta2-delta+0.25);
-    Sx0[2] = 0.75-delta2;
-    Sx0[3] = 0.5 * (delta2+delta+0.25);
-    Sx0[4] = 0.;
-    
-    delta = *(deltaold+1);
-    delta2 = delta*delta;
-    Sy0[0] = 0.;
-    Sy0[1] = 0.5 * (delta2-delta+0.25);
-    Sy0[2] = 0.75-delta2;
-    Sy0[3] = 0.5 * (delta2+delta+0.25);
-    Sy0[4] = 0.;
-    
-    delta = *(deltaold+2);
-    delta2 = delta*delta;
-    Sz0[0] = 0.;
-    Sz0[1] = 0.5 * (delta2-delta+0.25);
-    Sz0[2] = 0.75-delta2;
-    Sz0[3] = 0.5 * (delta2+delta+0.25);
-    Sz0[4] = 0.;
-    
-    // locate the particle on the primal grid at current time-step & calculate coeff. S1
-    xpn = particles.position(0, ipart) * dx_inv_;
-    int ip = round(xpn);
-    int ipo = *iold;
-    int ip_m_ipo = ip-ipo-i_domain_begin;
-    delta  = xpn - (double)ip;
-    delta2 = delta*delta;
-    Sx1[ip_m_ipo+1] = 0.5 * (delta2-delta+0.25);
-    Sx1[ip_m_ipo+2] = 0.75-delta2;
-    Sx1[ip_m_ipo+3] = 0.5 * (delta2+delta+0.25);
-    
-    ypn = particles.position(1, ipart) * dy_inv_;
-    int jp = round(ypn);
-    int jpo = *(iold+1);
-    int jp_m_jpo = jp-jpo-j_domain_begin;
-    delta  = ypn - (double)jp;
-    delta2 = delta*delta;
-    Sy1[jp_m_jpo+1] = 0.5 * (delta2-delta+0.25);
-    Sy1[jp_m_jpo+2] = 0.75-delta2;
-    Sy1[jp_m_jpo+3] = 0.5 * (delta2+delta+0.25);
-    
-    zpn = particles.position(2, ipart) * dz_inv_;
-    int kp = round(zpn);
-    int kpo = *(iold+2);
-    int kp_m_kpo = kp-kpo-k_domain_begin;
-    delta  = zpn - (double)kp;
-    delta2 = delta*delta;
-    Sz1[kp_m_kpo+1] = 0.5 * (delta2-delta+0.25);
-    Sz1[kp_m_kpo+2] = 0.75-delta2;
-    Sz1[kp_m_kpo+3] = 0.5 * (delta2+delta+0.25);
-    
-    // computes Esirkepov coefficients
-    for (unsigned int i=0; i < 5; i++) {
-        DSx[i] = Sx1[i] - Sx0[i];
-        DSy[i] = Sy1[i] - Sy0[i];
-        DSz[i] = Sz1[i] - Sz0[i];
-    }
+    // Strides of the bin arrays : Jx^(d,p,p), Jy^(p,d,p), Jz^(p,p,d), rho^(p,p,p)
+    int sx_Jx = b_dim[2]*b_dim[1]    , sy_Jx = b_dim[2];
+    int sx_Jy = b_dim[2]*(b_dim[1]+1), sy_Jy = b_dim[2];
+    int sx_Jz = (b_dim[2]+1)*b_dim[1], sy_Jz = b_dim[2]+1;
+    
+    double inv_cell_length[3] = { dx_inv_, dy_inv_, dz_inv_ };
+    int domain_begin[3] = { i_domain_begin, j_domain_begin, k_domain_begin };
+    
+    double charge_weight[block_size], crx_p[block_size], cry_p[block_size], crz_p[block_size];
+    double delta0[3][block_size], delta1[3][block_size];
+    int shift[3][block_size], ipo[block_size], jpo[block_size], kpo[block_size];
+    double Sx0[5*block_size], Sy0[5*block_size], Sz0[5*block_size];
+    double DSx[5*block_size], DSy[5*block_size], DSz[5*block_size];
+    double bJx[100*block_size], bJy[100*block_size], bJz[100*block_size], brho[125*block_size];
+    
+    for ( int ivect=istart ; ivect<iend ; ivect+=block_size ) {
+        int np = min( block_size, iend-ivect );
         
-    // ---------------------------
-    // Calculate the total current
-    // ---------------------------
-
-    ipo -= bin+2;   //This minus 2 come from the order 2 scheme, based on a 5 points stencil from -2 to +2.
-                    // i/j/kpo stored with - i/j/k_domain_begin in Interpolator
-    jpo -= 2;
-    kpo -= 2;
-    
-    int iloc, jloc, kloc, linindex;
-    
-    // Jx^(d,p,p)
-    for (unsigned int i=1 ; i<5 ; i++) {
-        iloc = i+ipo;
-        for (unsigned int j=0 ; j<5 ; j++) {
-            jloc = j+jpo;
-            for (unsigned int k=0 ; k<5 ; k++) {
-                tmpJx[j][k] -= crx_p * DSx[i-1] * (Sy0[j]*Sz0[k] + 0.5*DSy[j]*Sz0[k] + 0.5*DSz[k]*Sy0[j] + one_third*DSy[j]*DSz[k]);
-                kloc = k+kpo;
-                linindex = iloc*b_dim[2]*b_dim[1]+jloc*b_dim[2]+kloc;
-                Jx [linindex] += tmpJx[j][k]; // iloc = (i+ipo)*b_dim[1];
+        // Locate the particles on the primal grid at the former and current time-steps
+        for ( int ipart=0 ; ipart<np ; ipart++ ) {
+            int jpart = ivect+ipart;
+            charge_weight[ipart] = (double)(particles.charge(jpart))*particles.weight(jpart);
+            for ( unsigned int idim=0 ; idim<3 ; idim++ ) {
+                double pos = particles.position(idim, jpart) * inv_cell_length[idim];
+                int ip = round(pos);
+                shift [idim][ipart] = ip - iold[3*jpart+idim] - domain_begin[idim];
+                delta0[idim][ipart] = deltaold[3*jpart+idim];
+                delta1[idim][ipart] = pos - (double)ip;
             }
+            // i/j/kpo stored with - i/j/k_domain_begin in Interpolator, -2 for the 5 points stencil from -2 to +2
+            ipo[ipart] = iold[3*jpart  ] - bin - 2;
+            jpo[ipart] = iold[3*jpart+1] - 2;
+            kpo[ipart] = iold[3*jpart+2] - 2;
         }
-    }//i
-    
-    // Jy^(p,d,p)
-    for (unsigned int i=0 ; i<5 ; i++) {
-        iloc = i+ipo;
-        for (unsigned int j=1 ; j<5 ; j++) {
-            jloc = j+jpo;
-            for (unsigned int k=0 ; k<5 ; k++) {
-                tmpJy[i][k] -= cry_p * DSy[j-1] * (Sz0[k]*Sx0[i] + 0.5*DSz[k]*Sx0[i] + 0.5*DSx[i]*Sz0[k] + one_third*DSz[k]*DSx[i]);
-                kloc = k+kpo;
-                linindex = iloc*b_dim[2]*(b_dim[1]+1)+jloc*b_dim[2]+kloc;
-                Jy [linindex] += tmpJy[i][k]; //
+        
+        bool same_nodes = true;
+        for ( int ipart=1 ; ipart<np ; ipart++ )
+            same_nodes = same_nodes && ipo[ipart]==ipo[0] && jpo[ipart]==jpo[0] && kpo[ipart]==kpo[0];
+        
+        // Esirkepov coefficients
+        blockCoeffs( delta0[0], delta1[0], shift[0], Sx0, DSx, np );
+        blockCoeffs( delta0[1], delta1[1], shift[1], Sy0, DSy, np );
+        blockCoeffs( delta0[2], delta1[2], shift[2], Sz0, DSz, np );
+        
+        #pragma omp simd
+        for ( int ipart=0 ; ipart<np ; ipart++ ) {
+            crx_p[ipart] = charge_weight[ipart]*dx_ov_dt;
+            cry_p[ipart] = charge_weight[ipart]*dy_ov_dt;
+            crz_p[ipart] = charge_weight[ipart]*dz_ov_dt;
+        }
+        
+        // Jx^(d,p,p) : cumulative sum along x, i=1..4
+        for ( int j=0 ; j<5 ; j++ ) {
+            for ( int k=0 ; k<5 ; k++ ) {
+                #pragma omp simd
+                for ( int ipart=0 ; ipart<np ; ipart++ ) {
+                    int jb = j*block_size+ipart, kb = k*block_size+ipart;
+                    double W = Sy0[jb]*Sz0[kb] + 0.5*DSy[jb]*Sz0[kb] + 0.5*DSz[kb]*Sy0[jb] + one_third*DSy[jb]*DSz[kb];
+                    double tmpJx = 0.;
+                    for ( int i=1 ; i<5 ; i++ ) {
+                        tmpJx -= crx_p[ipart] * DSx[(i-1)*block_size+ipart] * W;
+                        bJx[(((i-1)*5+j)*5+k)*block_size+ipart] = tmpJx;
+                    }
+                }
             }
         }
-    }//i
-    
-    // Jz^(p,p,d)
-    for (unsigned int i=0 ; i<5 ; i++) {
-        iloc = i+ipo;
-        for (unsigned int j=0 ; j<5 ; j++) {
-            jloc = j+jpo;
-            for (unsigned int k=1 ; k<5 ; k++) {
-                tmpJz[i][j] -= crz_p * DSz[k-1] * (Sx0[i]*Sy0[j] + 0.5*DSx[i]*Sy0[j] + 0.5*DSy[j]*Sx0[i] + one_third*DSx[i]*DSy[j]);
-                kloc = k+kpo;
-                linindex = iloc*(b_dim[2]+1)*b_dim[1]+jloc*(b_dim[2]+1)+kloc;
-                Jz [linindex] += tmpJz[i][j]; //
+        addBlock( Jx, bJx, 4, 5, 5, 1, 0, 0, sx_Jx, sy_Jx, ipo, jpo, kpo, np, same_nodes );
+        
+        // Jy^(p,d,p) : cumulative sum along y, j=1..4
+        for ( int i=0 ; i<5 ; i++ ) {
+            for ( int k=0 ; k<5 ; k++ ) {
+                #pragma omp simd
+                for ( int ipart=0 ; ipart<np ; ipart++ ) {
+                    int ib = i*block_size+ipart, kb = k*block_size+ipart;
+                    double W = Sz0[kb]*Sx0[ib] + 0.5*DSz[kb]*Sx0[ib] + 0.5*DSx[ib]*Sz0[kb] + one_third*DSz[kb]*DSx[ib];
+                    double tmpJy = 0.;
+                    for ( int j=1 ; j<5 ; j++ ) {
+                        tmpJy -= cry_p[ipart] * DSy[(j-1)*block_size+ipart] * W;
+                        bJy[((i*4+j-1)*5+k)*block_size+ipart] = tmpJy;
+                    }
+                }
             }
         }
-    }//i
-
-    // Rho^(p,p,p)
-    for (unsigned int i=0 ; i<5 ; i++) {
-        iloc = i+ipo;
-        for (unsigned int j=0 ; j<5 ; j++) {
-            jloc = j+jpo;
-            for (unsigned int k=0 ; k<5 ; k++) {
-                kloc = k+kpo;
-                linindex = iloc*b_dim[2]*b_dim[1]+jloc*b_dim[2]+kloc;
-                rho[linindex] += charge_weight * Sx1[i]*Sy1[j]*Sz1[k];
+        addBlock( Jy, bJy, 5, 4, 5, 0, 1, 0, sx_Jy, sy_Jy, ipo, jpo, kpo, np, same_nodes );
+        
+        // Jz^(p,p,d) : cumulative sum along z, k=1..4
+        for ( int i=0 ; i<5 ; i++ ) {
+            for ( int j=0 ; j<5 ; j++ ) {
+                #pragma omp simd
+                for ( int ipart=0 ; ipart<np ; ipart++ ) {
+                    int ib = i*block_size+ipart, jb = j*block_size+ipart;
+                    double W = Sx0[ib]*Sy0[jb] + 0.5*DSx[ib]*Sy0[jb] + 0.5*DSy[jb]*Sx0[ib] + one_third*DSx[ib]*DSy[jb];
+                    double tmpJz = 0.;
+                    for ( int k=1 ; k<5 ; k++ ) {
+                        tmpJz -= crz_p[ipart] * DSz[(k-1)*block_size+ipart] * W;
+                        bJz[((i*5+j)*4+k-1)*block_size+ipart] = tmpJz;
+                    }
+                }
             }
         }
-    }//i
+        addBlock( Jz, bJz, 5, 5, 4, 0, 0, 1, sx_Jz, sy_Jz, ipo, jpo, kpo, np, same_nodes );
+        
+        // Rho^(p,p,p), with S1 = S0 + DS
+        if (rho) {
+            for ( int i=0 ; i<5 ; i++ ) {
+                for ( int j=0 ; j<5 ; j++ ) {
+                    for ( int k=0 ; k<5 ; k++ ) {
+                        #pragma omp simd
+                        for ( int ipart=0 ; ipart<np ; ipart++ ) {
+                            int ib = i*block_size+ipart, jb = j*block_size+ipart, kb = k*block_size+ipart;
+                            brho[((i*5+j)*5+k)*block_size+ipart] = charge_weight[ipart]
+                                * (Sx0[ib]+DSx[ib]) * (Sy0[jb]+DSy[jb]) * (Sz0[kb]+DSz[kb]);
+                        }
+                    }
+                }
+            }
+            addBlock( rho, brho, 5, 5, 5, 0, 0, 0, sx_Jx, sy_Jx, ipo, jpo, kpo, np, same_nodes );
+        }
+    }
+    
+} // END Project local current densities (Jx, Jy, Jz, rho, sort)
 
-} // END Project local densities (Jx, Jy, Jz, rho, sort)
+void Projector3D2Order::currents( double* Jx, double* Jy, double* Jz, double* rho, Particles &particles, int istart, int iend,
+                                  unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold )
+{
+    if (particles.singlePrecision)
+        currents( Jx, Jy, Jz, rho, ParticleArrays<float >(particles), istart, iend, bin, b_dim, iold, deltaold );
+    else
+        currents( Jx, Jy, Jz, rho, ParticleArrays<double>(particles), istart, iend, bin, b_dim, iold, deltaold );
+}
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -384,7 +258,7 @@ void Projector3D2Order::operator() (double* Jx, double* Jy, double* Jz, double*
 // ---------------------------------------------------------------------------------------------------------------------
 void Projector3D2Order::operator() (double* rho, Particles &particles, unsigned int ipart, unsigned int bin, std::vector<unsigned int> &b_dim)
 {
-    //Warning : this function is used for frozen species only. It is assumed that position = position_old !!!
+    //Warning : this function is used for frozen species only. The particle does not move, so only its current position is used !!!
 
     // -------------------------------------
     // Variable declaration & initialization
@@ -570,7 +444,6 @@ void Projector3D2Order::operator() (ElectroMagn* EMfields, Particles &particles,
 {
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
-    std::vector<double> *invgf = &(smpi->dynamics_invgf[ithread]);
     
     int dim1 = EMfields->dimPrim[1];
     int dim2 = EMfields->dimPrim[2];
@@ -580,17 +453,15 @@ void Projector3D2Order::operator() (ElectroMagn* EMfields, Particles &particles,
         double* b_Jx =  &(*EMfields->Jx_ )(ibin*clrw* dim1   * dim2   );
         double* b_Jy =  &(*EMfields->Jy_ )(ibin*clrw*(dim1+1)* dim2   );
         double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw* dim1   *(dim2+1));
-        for ( int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[3*ipart], &(*delta)[3*ipart]);
+        currents( b_Jx, b_Jy, b_Jz, NULL, particles, istart, iend, ibin*clrw, b_dim, iold->data(), delta->data() );
             
     // Otherwise, the projection may apply to the species-specific arrays
     } else {
-        double* b_Jx  = EMfields->Jx_s [ispec] ? &(*EMfields->Jx_s [ispec])(ibin*clrw* dim1   *dim2) : &(*EMfields->Jx_ )(ibin*clrw* dim1   *dim2) ;
-        double* b_Jy  = EMfields->Jy_s [ispec] ? &(*EMfields->Jy_s [ispec])(ibin*clrw*(dim1+1)*dim2) : &(*EMfields->Jy_ )(ibin*clrw*(dim1+1)*dim2) ;
-        double* b_Jz  = EMfields->Jz_s [ispec] ? &(*EMfields->Jz_s [ispec])(ibin*clrw*dim1*(dim2+1)) : &(*EMfields->Jz_ )(ibin*clrw*dim1*(dim2+1)) ;
-        double* b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(ibin*clrw* dim1   *dim2) : &(*EMfields->rho_)(ibin*clrw* dim1   *dim2) ;
-        for ( int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[3*ipart], &(*delta)[3*ipart]);
+        double* b_Jx  = EMfields->Jx_s_now [ispec] ? &(*EMfields->Jx_s_now [ispec])(ibin*clrw* dim1   *dim2) : &(*EMfields->Jx_ )(ibin*clrw* dim1   *dim2) ;
+        double* b_Jy  = EMfields->Jy_s_now [ispec] ? &(*EMfields->Jy_s_now [ispec])(ibin*clrw*(dim1+1)*dim2) : &(*EMfields->Jy_ )(ibin*clrw*(dim1+1)*dim2) ;
+        double* b_Jz  = EMfields->Jz_s_now [ispec] ? &(*EMfields->Jz_s_now [ispec])(ibin*clrw*dim1*(dim2+1)) : &(*EMfields->Jz_ )(ibin*clrw*dim1*(dim2+1)) ;
+        double* b_rho = EMfields->rho_s_now[ispec] ? &(*EMfields->rho_s_now[ispec])(ibin*clrw* dim1   *dim2) : &(*EMfields->rho_)(ibin*clrw* dim1   *dim2) ;
+        currents( b_Jx, b_Jy, b_Jz, b_rho, particles, istart, iend, ibin*clrw, b_dim, iold->data(), delta->data() );
     }
 
 }
@@ -9,10 +9,11 @@ public:
     Projector3D2Order(Params&, Patch* patch);
     ~Projector3D2Order();
 
-    //! Project global current densities (EMfields->Jx_/Jy_/Jz_)
-    inline void operator() (double* Jx, double* Jy, double* Jz, Particles &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold);
-    //! Project global current densities (EMfields->Jx_/Jy_/Jz_/rho), diagFields timestep
-    inline void operator() (double* Jx, double* Jy, double* Jz, double* rho, Particles &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold);
+    //! Project global current densities (EMfields->Jx_/Jy_/Jz_), and rho if not NULL (diagFields timestep), of a bin
+    void currents( double* Jx, double* Jy, double* Jz, double* rho, Particles &particles, int istart, int iend, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold );
+    //! Same, for particles stored in precision real
+    template<typename real>
+    void currents( double* Jx, double* Jy, double* Jz, double* rho, const ParticleArrays<real> &particles, int istart, int iend, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold );
 
     //! Project global current charge (EMfields->rho_), frozen & diagFields timestep
     void operator() (double* rho, Particles &particles, unsigned int ipart, unsigned int bin, std::vector<unsigned int> &b_dim) override final;
@@ -23,7 +24,16 @@ public:
     //!Wrapper
     void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, bool diag_flag, std::vector<unsigned int> &b_dim, int ispec) override final;
 
+    //! Number of particles projected together by currents()
+    static const int block_size = 8;
+
 private:
+    //! Esirkepov coefficients of a block of particles
+    void blockCoeffs( const double* delta0, const double* delta1, const int* shift, double* S0, double* DS, int np );
+    //! Add the stencils of a block of particles to a bin array
+    void addBlock( double* J, const double* bJ, int ni, int nj, int nk, int i0, int j0, int k0, int sx, int sy,
+                   const int* ipo, const int* jpo, const int* kpo, int np, bool same_nodes );
+    
     double one_third;
 };
 
@@ -58,6 +58,7 @@ def _smilei_check():
         s.nb_density      = toSpaceProfile(s.nb_density      )
         s.charge_density  = toSpaceProfile(s.charge_density  )
         s.n_part_per_cell = toSpaceProfile(s.n_part_per_cell )
+        s.resampling_ppc  = toSpaceProfile(s.resampling_ppc  )
         s.charge          = toSpaceProfile(s.charge          )
         s.mean_velocity   = [ toSpaceProfile(p) for p in s.mean_velocity ]
         s.temperature     = [ toSpaceProfile(p) for p in s.temperature   ]
@@ -79,6 +80,7 @@ def _keep_python_running():
     profiles = [las.time_envelope for las in Laser]
     profiles += [las.chirp_profile for las in Laser]
     profiles += [ant.time_profile for ant in Antenna]
+    profiles += [s.resampling_ppc for s in Species if s.resampling_ppc is not None]
     if len(MovingWindow)>0 or len(LoadBalancing)>0:
         for s in Species:
             profiles += [s.nb_density, s.charge_density, s.n_part_per_cell, s.charge] + s.mean_velocity + s.temperature
@@ -124,6 +124,7 @@ class Main(SmileiSingleton):
     interpolation_order = 2
     number_of_patches = None
     clrw = 1
+    chunk_size = 1024
     timestep = None
     timestep_over_CFL = None
     
@@ -258,6 +259,18 @@ class Species(SmileiComponent):
     track_every = 0
     track_flush_every = 1
     track_filter = None
+    precision = "double"
+    push_precision = "double"
+    sort_mode = "bin"
+    sort_threshold = 0.
+    subcycle = 1
+    merging_method = "none"
+    merge_every = 0
+    merge_min_particles_per_cell = 4
+    merge_momentum_cells = [4, 4, 4]
+    resampling_ppc = None
+    resampling_every = 0
+    resampling_ceiling = 2.
 
 class Laser(SmileiComponent):
     """Laser parameters"""
@@ -94,6 +94,7 @@ int main (int argc, char* argv[])
         // smpi->patch_count recomputed in restartAll
         // vecPatches allocated in restartAll according to patch_count saved
         checkpoint.restartAll( vecPatches, smpi, simWindow, params, openPMD);
+        timers.initSort( vecPatches(0)->vecSpecies, smpi );
         
         // time at integer time-steps (primal grid)
         time_prim = checkpoint.this_run_start_step * params.timestep;
@@ -109,6 +110,7 @@ int main (int argc, char* argv[])
     } else {
         
         vecPatches = PatchesFactory::createVector(params, smpi, openPMD, 0);
+        timers.initSort( vecPatches(0)->vecSpecies, smpi );
         
         // Initialize the electromagnetic fields
         // -------------------------------------
@@ -144,6 +146,7 @@ int main (int argc, char* argv[])
 
         vecPatches.finalize_and_sort_parts(params, smpi, simWindow, time_dual, timers, 0);
         timers.syncPart .reboot();
+        timers.initSort( vecPatches(0)->vecSpecies, smpi );
 
         TITLE("Initializing diagnostics");
         vecPatches.initAllDiags( params, smpi );
@@ -223,8 +226,10 @@ int main (int argc, char* argv[])
             // ----------------------------------------------------------------------        
             
             timers.movWindow.restart();
-            #pragma omp single
+            // Always the same thread, which recycles the memory of the patches in its MemoryPool
+            #pragma omp master
             simWindow->operate(vecPatches, smpi, params, itime, time_dual);
+            #pragma omp barrier
             timers.movWindow.update();
         
             if ((params.balancing_every > 0) && (smpi->getSize()!=1) ) {
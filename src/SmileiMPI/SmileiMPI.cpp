@@ -517,15 +517,28 @@ int SmileiMPI::hrank(int h)
 // ----------------------------------------------------------------------
 MPI_Datatype SmileiMPI::createMPIparticles( Particles* particles )
 {
-    int nbrOfProp = particles->double_prop.size() + particles->short_prop.size() + particles->uint64_prop.size();
+    int nbrOfProp = particles->double_prop.size() + particles->float_prop.size() + particles->short_prop.size() + particles->uint64_prop.size();
 
     MPI_Aint address[nbrOfProp];
-    for ( unsigned int iprop=0 ; iprop<particles->double_prop.size() ; iprop++ )
-        MPI_Get_address( &( (*(particles->double_prop[iprop]))[0] ), &(address[iprop]) );
-    for ( unsigned int iprop=0 ; iprop<particles->short_prop.size() ; iprop++ )
-        MPI_Get_address( &( (*(particles->short_prop[iprop]))[0] ), &(address[particles->double_prop.size()+iprop]) );
-    for ( unsigned int iprop=0 ; iprop<particles->uint64_prop.size() ; iprop++ )
-        MPI_Get_address( &( (*(particles->uint64_prop[iprop]))[0] ), &(address[particles->double_prop.size()+particles->short_prop.size()+iprop]) );
+    MPI_Datatype partDataType[nbrOfProp];
+    // address and MPI type of each property, in the order of the arena
+    int iMPIprop = 0;
+    for ( unsigned int iprop=0 ; iprop<particles->double_prop.size() ; iprop++, iMPIprop++ ) {
+        MPI_Get_address( &( (*(particles->double_prop[iprop]))[0] ), &(address[iMPIprop]) );
+        partDataType[iMPIprop] = MPI_DOUBLE;
+    }
+    for ( unsigned int iprop=0 ; iprop<particles->float_prop.size() ; iprop++, iMPIprop++ ) {
+        MPI_Get_address( &( (*(particles->float_prop[iprop]))[0] ), &(address[iMPIprop]) );
+        partDataType[iMPIprop] = MPI_FLOAT;
+    }
+    for ( unsigned int iprop=0 ; iprop<particles->short_prop.size() ; iprop++, iMPIprop++ ) {
+        MPI_Get_address( &( (*(particles->short_prop[iprop]))[0] ), &(address[iMPIprop]) );
+        partDataType[iMPIprop] = MPI_SHORT;
+    }
+    for ( unsigned int iprop=0 ; iprop<particles->uint64_prop.size() ; iprop++, iMPIprop++ ) {
+        MPI_Get_address( &( (*(particles->uint64_prop[iprop]))[0] ), &(address[iMPIprop]) );
+        partDataType[iMPIprop] = MPI_UNSIGNED_LONG_LONG;
+    }
 
     int nbr_parts[nbrOfProp];
     // number of elements per property
@@ -533,19 +546,11 @@ MPI_Datatype SmileiMPI::createMPIparticles( Particles* particles )
         nbr_parts[i] = particles->size();
 
     MPI_Aint disp[nbrOfProp];
-    // displacement between 2 properties
-    disp[0] = 0;
-    for (int i=1 ; i<nbrOfProp ; i++)
-        disp[i] = address[i] - address[0];
-
-    MPI_Datatype partDataType[nbrOfProp];
-    // define MPI type of each property, default is DOUBLE
-    for ( unsigned int i=0 ; i<particles->double_prop.size() ; i++)
-        partDataType[i] = MPI_DOUBLE;
-    for ( unsigned int iprop=0 ; iprop<particles->short_prop.size() ; iprop++ )
-        partDataType[ particles->double_prop.size()+iprop] = MPI_SHORT;
-    for ( unsigned int iprop=0 ; iprop<particles->uint64_prop.size() ; iprop++ )
-        partDataType[ particles->double_prop.size()+particles->short_prop.size()+iprop] = MPI_UNSIGNED_LONG_LONG;
+    // displacement of each property from the start of the arena (the buffer given to MPI)
+    MPI_Aint base;
+    MPI_Get_address( particles->address(), &base );
+    for (int i=0 ; i<nbrOfProp ; i++)
+        disp[i] = address[i] - base;
 
     MPI_Datatype typeParticlesMPI;
     MPI_Type_create_struct( nbrOfProp, &(nbr_parts[0]), &(disp[0]), &(partDataType[0]), &typeParticlesMPI);
@@ -636,7 +641,7 @@ void SmileiMPI::recv(Patch* patch, int from, int tag, Params& params)
 
 void SmileiMPI::isend(Particles* particles, int to, int tag, MPI_Datatype typePartSend, MPI_Request& request)
 {
-    MPI_Isend( &(particles->position(0,0)), 1, typePartSend, to, tag, MPI_COMM_WORLD, &request );
+    MPI_Isend( particles->address(), 1, typePartSend, to, tag, MPI_COMM_WORLD, &request );
 
 } // END isend( Particles )
 
@@ -644,7 +649,7 @@ void SmileiMPI::isend(Particles* particles, int to, int tag, MPI_Datatype typePa
 void SmileiMPI::recv(Particles* particles, int to, int tag, MPI_Datatype typePartRecv)
 {
     MPI_Status status;
-    MPI_Recv( &(particles->position(0,0)), 1, typePartRecv, to, tag, MPI_COMM_WORLD, &status );
+    MPI_Recv( particles->address(), 1, typePartRecv, to, tag, MPI_COMM_WORLD, &status );
 
 } // END recv( Particles )
 
@@ -846,7 +851,7 @@ void SmileiMPI::isend( ProbeParticles* probe, int to, int tag, unsigned int nDim
     // send particles
     if( nPart>0 )
         for( unsigned int i=0; i<nDim_particles; i++)
-            MPI_Isend( &(probe->particles.Position[i][0]), nPart, MPI_DOUBLE, to, tag+1+i, MPI_COMM_WORLD, &request );
+            MPI_Isend( probe->particles.Position[i].data<double>(), nPart, MPI_DOUBLE, to, tag+1+i, MPI_COMM_WORLD, &request );
 
 } // End isend ( probes )
 
@@ -864,7 +869,7 @@ void SmileiMPI::recv( ProbeParticles* probe, int from, int tag, unsigned int nDi
     // receive particles
     if( nPart>0 )
         for( unsigned int i=0; i<nDim_particles; i++)
-            MPI_Recv( &(probe->particles.Position[i][0]), nPart, MPI_DOUBLE, from, tag+1+i, MPI_COMM_WORLD, &status );
+            MPI_Recv( probe->particles.Position[i].data<double>(), nPart, MPI_DOUBLE, from, tag+1+i, MPI_COMM_WORLD, &status );
 
 } // End recv ( probes )
 
@@ -121,10 +121,10 @@ public:
     // Global buffers for vectorization of Species::dynamics
     // -----------------------------------------------------
     
-    //! value of the Efield 
-    std::vector<std::vector<LocalFields>> dynamics_Epart;
-    //! value of the Bfield
-    std::vector<std::vector<LocalFields>> dynamics_Bpart;
+    //! value of the Efield, structure of arrays : Ex of all the particles, then Ey, then Ez
+    std::vector<std::vector<double>> dynamics_Epart;
+    //! value of the Bfield, structure of arrays : Bx of all the particles, then By, then Bz
+    std::vector<std::vector<double>> dynamics_Bpart;
     //! gamma factor
     std::vector<std::vector<double>> dynamics_invgf;
     //! iold_pos
@@ -134,8 +134,8 @@ public:
     
     // Resize buffers for a given number of particles
     inline void dynamics_resize(int ithread, int ndim_part, int npart ){
-        dynamics_Epart[ithread].resize(npart);
-        dynamics_Bpart[ithread].resize(npart);
+        dynamics_Epart[ithread].resize(3*npart);
+        dynamics_Bpart[ithread].resize(3*npart);
         dynamics_invgf[ithread].resize(npart);
         dynamics_iold[ithread].resize(ndim_part*npart);
         dynamics_deltaold[ithread].resize(ndim_part*npart);
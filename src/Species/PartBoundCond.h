@@ -38,6 +38,8 @@ public:
     //! The decision whether the particle is added or not on the Exchange Particle List is defined by the final
     //! value of keep_part. 
     //! Be careful, once an a BC along a given dimension set keep_part to 0, it will remain to 0. 
+    //! Instantiated for the number of dimensions nDim of the particles (see Species::applyBoundaryConditions)
+    template<int nDim>
     inline int apply( Particles &particles, int ipart, Species *species, double &nrj_iPart ) {//, bool &contribute ) {
         
         int keep_part = 1;
@@ -53,7 +55,7 @@ public:
                 keep_part = (*bc_xmax)( particles, ipart, 0, 2.*x_max, species,nrj_iPart );
             }
         }
-        if (nDim_particle >= 2) {
+        if (nDim >= 2) {
             
             if ( particles.position(1, ipart) <  y_min ) {
                 if (bc_ymin==NULL) keep_part = 0;
@@ -68,7 +70,7 @@ public:
                 }
             }
             
-            if (nDim_particle == 3) {
+            if (nDim == 3) {
                 
                 if ( particles.position(2, ipart) <  z_min ) {
                     if (bc_zmin==NULL) keep_part = 0;
@@ -82,13 +84,21 @@ public:
                         keep_part *= (*bc_zmax)( particles, ipart, 2, 2.*z_max, species,nrj_iPart );
                     }
                 }
-            } // end if (nDim_particle == 3)
-        } // end if (nDim_particle >= 2)
+            } // end if (nDim == 3)
+        } // end if (nDim >= 2)
 
 
         return keep_part;
     };
 
+    //! Tells whether the box [lo,hi] lies inside the local domain: no particle of the box needs boundary conditions
+    inline bool isInside( const double *lo, const double *hi ) {
+        if ( lo[0] < x_min || hi[0] >= x_max ) return false;
+        if ( nDim_particle >= 2 && ( lo[1] < y_min || hi[1] >= y_max ) ) return false;
+        if ( nDim_particle == 3 && ( lo[2] < z_min || hi[2] >= z_max ) ) return false;
+        return true;
+    };
+
     //! Set the condition window if restart (patch position not read)
     inline void updateMvWinLimits( double x_moved ) {
     }
@@ -30,6 +30,11 @@ public:
     //! Method which applies particles wall
     int apply (Particles &particles, int ipart, Species *species, double dtgf, double &nrj_iPart);
     
+    //! Tells whether a particle moving inside the box [lo,hi] may cross the wall
+    inline bool mayCross( const double *lo, const double *hi ) {
+        return position > lo[direction] && position < hi[direction];
+    };
+    
 private:
     //! position of a wall in its direction
     double position;
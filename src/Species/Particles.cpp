@@ -1,13 +1,16 @@
 #include "Particles.h"
 
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <algorithm>
 
 #include "Params.h"
 #include "Patch.h"
 #include "Species.h"
 
 #include "Particle.h"
+#include "MemoryPool.h"
 
 using namespace std;
 
@@ -17,17 +20,83 @@ using namespace std;
 // Constructor for Particle
 // ---------------------------------------------------------------------------------------------------------------------
 Particles::Particles():
-tracked(false)
+tracked(false),
+singlePrecision(false),
+double_prop( properties.list<double  >() ),
+float_prop ( properties.list<float   >() ),
+short_prop ( properties.list<short   >() ),
+uint64_prop( properties.list<uint64_t>() ),
+arena_(NULL),
+nParticles_(0),
+capacity_(0)
 {
     Position.resize(0);
-    Position_old.resize(0);
     Momentum.resize(0);
     isTest = false;
     isRadReaction = false;
 
-    double_prop.resize(0);
-    short_prop.resize(0);
-    uint64_prop.resize(0);
+    real_prop.resize(0);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy constructor for Particle : properties are defined as in part, and its arena is duplicated
+// ---------------------------------------------------------------------------------------------------------------------
+Particles::Particles( const Particles& part ):
+tracked(false),
+singlePrecision(false),
+double_prop( properties.list<double  >() ),
+float_prop ( properties.list<float   >() ),
+short_prop ( properties.list<short   >() ),
+uint64_prop( properties.list<uint64_t>() ),
+arena_(NULL),
+nParticles_(0),
+capacity_(0)
+{
+    isTest = false;
+    isRadReaction = false;
+    *this = part;
+}
+
+Particles& Particles::operator=( const Particles& part )
+{
+    if ( this == &part )
+        return *this;
+    
+    MemoryPool::release( arena_, capacity_*bytes_per_particle() );
+    arena_      = NULL;
+    nParticles_ = 0;
+    capacity_   = 0;
+    properties.clear();
+    real_prop .clear();
+    Position    .clear();
+    Momentum    .clear();
+    Weight = ParticleRealProperty();
+    Chi    = ParticleProperty<double>();
+    Charge = ParticleProperty<short>();
+    Id     = ParticleProperty<uint64_t>();
+    
+    isTest        = part.isTest;
+    tracked       = part.tracked;
+    isRadReaction = part.isRadReaction;
+    singlePrecision = part.singlePrecision;
+    
+    if ( part.properties_defined() ) {
+        define_properties( part.Position.size() );
+        reallocate( part.size() );
+        nParticles_ = part.size();
+        if ( nParticles_>0 )
+            properties.copy( part.properties, 0, 0, nParticles_ );
+    }
+    
+    return *this;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor for Particle
+// ---------------------------------------------------------------------------------------------------------------------
+Particles::~Particles()
+{
+    MemoryPool::release( arena_, capacity_*bytes_per_particle() );
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -38,7 +107,10 @@ void Particles::initialize(unsigned int nParticles, unsigned int nDim)
     //if (nParticles > Weight.capacity()) {
     //    WARNING("You should increase c_part_max in specie namelist");
     //}
-    if (Weight.size()==0) {
+    if ( !properties_defined() ) // do this just once 
+        define_properties( nDim );
+    
+    if (size()==0) {
         float c_part_max =1.2;
         //float c_part_max = part.c_part_max;
         //float c_part_max = params.species_param[0].c_part_max;
@@ -47,34 +119,6 @@ void Particles::initialize(unsigned int nParticles, unsigned int nDim)
     
     resize(nParticles, nDim);
     
-    if ( double_prop.empty() ) { // do this just once 
-        
-        Position.resize(nDim);
-        for (unsigned int i=0 ; i< nDim ; i++)
-            double_prop.push_back( &(Position[i]) );
-        
-        for (unsigned int i=0 ; i< 3 ; i++)
-            double_prop.push_back( &(Momentum[i]) );
-        
-        double_prop.push_back( &Weight );
-        
-#ifdef  __DEBUG
-        Position_old.resize(nDim);
-        for (unsigned int i=0 ; i< nDim ; i++)
-            double_prop.push_back( &(Position_old[i]) );
-#endif
-        
-        short_prop.push_back( &Charge );
-        if (tracked) {
-            uint64_prop.push_back( &Id );
-        }
-        
-        if (isRadReaction) {
-            double_prop.push_back( &Chi );
-        }
-        
-    }
-    
 }
 
 // copy properties from another Particles
@@ -86,78 +130,141 @@ void Particles::initialize(unsigned int nParticles, Particles &part)
     
     isRadReaction=part.isRadReaction;
     
+    singlePrecision=part.singlePrecision;
+    
     initialize(nParticles, part.Position.size());
 }
 
 
-
 // ---------------------------------------------------------------------------------------------------------------------
-// Set capacity of Particles vectors
+// List the properties stored in the arena, respect type order : all double, all short, all unsigned int
 // ---------------------------------------------------------------------------------------------------------------------
-void Particles::reserve( unsigned int n_part_max, unsigned int nDim )
+void Particles::define_properties( unsigned int nDim )
 {
-    return;
-
     Position.resize(nDim);
-    Position_old.resize(nDim);
-    for (unsigned int i=0 ; i< nDim ; i++) {
-        Position[i].reserve(n_part_max);
-        Position_old[i].reserve(n_part_max);
-    }
+    for (unsigned int i=0 ; i< nDim ; i++)
+        add_real_property( Position[i], false );
+    
     Momentum.resize(3);
-    for (unsigned int i=0 ; i< 3 ; i++) {
-        Momentum[i].reserve(n_part_max);
+    for (unsigned int i=0 ; i< 3 ; i++)
+        add_real_property( Momentum[i] );
+    
+    add_real_property( Weight );
+    
+    short_prop.push_back( &Charge );
+    if (tracked) {
+        uint64_prop.push_back( &Id );
     }
-    Weight.reserve(n_part_max);
-    Charge.reserve(n_part_max);
     
-    if (tracked)
-        Id.reserve(n_part_max);
+    if (isRadReaction) {
+        double_prop.push_back( &Chi );
+    }
     
-    if (isRadReaction)
-        Chi.reserve(n_part_max);
+    bind_properties();
+}
+
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Real properties are stored in double, or in float for species with precision="single" (except the positions,
+// always in double: a float position loses the displacements smaller than its round-off, x*FLT_EPSILON)
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::add_real_property( ParticleRealProperty& prop, bool allowSingle )
+{
+    prop.single = singlePrecision && allowSingle;
+    if (prop.single)
+        float_prop.push_back( &(prop.f) );
+    else
+        double_prop.push_back( &(prop.d) );
+    real_prop.push_back( &prop );
 }
 
-void Particles::resize( unsigned int nParticles, unsigned int nDim )
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Make each property point to its slice of the arena
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::bind_properties()
 {
-    Position.resize(nDim);
-    for (unsigned int i=0 ; i<nDim ; i++)
-        Position[i].resize(nParticles, 0.);
-#ifdef  __DEBUG
-    Position_old.resize(nDim);
-    for (unsigned int i=0 ; i<nDim ; i++)
-        Position_old[i].resize(nParticles, 0.);
-#endif
+    char* start = arena_;
+    properties.bind( start, capacity_, &nParticles_ );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Move all properties in a new arena which can store n_part_max particles
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::reallocate( unsigned int n_part_max )
+{
+    // Round the capacity so that every property starts on an aligned address
+    const unsigned int granularity = arena_alignment/sizeof(short);
+    n_part_max = std::max( n_part_max, nParticles_ );
+    n_part_max = ( (n_part_max+granularity-1)/granularity ) * granularity;
     
-    Momentum.resize(3);
-    for (unsigned int i=0 ; i< 3 ; i++) {
-        Momentum[i].resize(nParticles, 0.);
+    size_t particle_size = bytes_per_particle();
+    
+    char* new_arena = NULL;
+    if ( n_part_max>0 && particle_size>0 ) {
+        size_t size = n_part_max*particle_size;
+        new_arena = (char*)MemoryPool::allocate( size );
+        // A block recycled from the pool may hold more particles
+        n_part_max = ( size/particle_size/granularity ) * granularity;
     }
     
-    Weight.resize(nParticles, 0.);
-    Charge.resize(nParticles, 0);
+    // Copy the particles stored in the old arena
+    char* dest = new_arena;
+    properties.relocate( dest, n_part_max, nParticles_ );
     
-    if (tracked) {
-        Id.resize(nParticles, 0);
-    }
+    MemoryPool::release( arena_, capacity_*bytes_per_particle() );
+    arena_    = new_arena;
+    capacity_ = n_part_max;
+    bind_properties();
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set capacity of Particles vectors
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::reserve( unsigned int n_part_max, unsigned int nDim )
+{
+    if ( !properties_defined() ) // properties not defined yet, nothing to allocate
+        return;
     
-    if (isRadReaction) {
-        Chi.resize(nParticles, 0.);
+    if ( n_part_max > capacity_ )
+        reallocate( n_part_max );
+}
+
+void Particles::resize( unsigned int nParticles, unsigned int nDim )
+{
+    if ( !properties_defined() )
+        define_properties( nDim );
+    
+    grow( nParticles );
+    
+    // New particles are null particles
+    if ( nParticles > nParticles_ ) {
+        properties.zero( nParticles_, nParticles - nParticles_ );
     }
+    
+    nParticles_ = nParticles;
 }
 
 void Particles::shrink_to_fit( unsigned int nDim )
 {
+    if ( capacity_ > nParticles_ )
+        reallocate( nParticles_ );
+}
 
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) 
-        std::vector<double>( *double_prop[iprop] ).swap( *double_prop[iprop] );
-        
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) 
-        std::vector<short>( *short_prop[iprop] ).swap( *short_prop[iprop] );
 
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) 
-        std::vector<uint64_t>( *uint64_prop[iprop] ).swap( *uint64_prop[iprop] );
+// ---------------------------------------------------------------------------------------------------------------------
+// Move the arena to a new one allocated and entirely written by the calling thread : with the first touch policy,
+// its pages are placed on the NUMA node of this thread
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::firstTouch()
+{
+    if ( !arena_ )
+        return;
+    
+    reallocate( capacity_ );
+    properties.zero( nParticles_, capacity_-nParticles_ );
 }
 
 
@@ -166,14 +273,7 @@ void Particles::shrink_to_fit( unsigned int nDim )
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::clear()
 {
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) 
-        double_prop[iprop]->clear();
-        
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) 
-        short_prop[iprop]->clear();
-
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) 
-        uint64_prop[iprop]->clear();
+    nParticles_ = 0;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -181,14 +281,11 @@ void Particles::clear()
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::cp_particle(unsigned int ipart, Particles &dest_parts )
 {
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) 
-        dest_parts.double_prop[iprop]->push_back( (*double_prop[iprop])[ipart] );
-        
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) 
-        dest_parts.short_prop[iprop]->push_back( (*short_prop[iprop])[ipart] );
-
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) 
-        dest_parts.uint64_prop[iprop]->push_back( (*uint64_prop[iprop])[ipart] );
+    unsigned int dest_id = dest_parts.size();
+    dest_parts.grow( dest_id+1 );
+    dest_parts.nParticles_++;
+    
+    dest_parts.properties.copy( properties, ipart, dest_id );
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -196,15 +293,7 @@ void Particles::cp_particle(unsigned int ipart, Particles &dest_parts )
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::cp_particle(unsigned int ipart, Particles &dest_parts, int dest_id )
 {
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) 
-        dest_parts.double_prop[iprop]->insert( dest_parts.double_prop[iprop]->begin() + dest_id, (*double_prop[iprop])[ipart] );
-        
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) 
-        dest_parts.short_prop[iprop]->insert( dest_parts.short_prop[iprop]->begin() + dest_id, (*short_prop[iprop])[ipart] );    
-
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) 
-        dest_parts.uint64_prop[iprop]->insert( dest_parts.uint64_prop[iprop]->begin() + dest_id, (*uint64_prop[iprop])[ipart] );    
-
+    cp_particles( ipart, 1, dest_parts, dest_id );
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -212,15 +301,13 @@ void Particles::cp_particle(unsigned int ipart, Particles &dest_parts, int dest_
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::cp_particles(unsigned int iPart, unsigned int nPart, Particles &dest_parts, int dest_id )
 {
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) 
-        dest_parts.double_prop[iprop]->insert( dest_parts.double_prop[iprop]->begin() + dest_id, double_prop[iprop]->begin()+iPart, double_prop[iprop]->begin()+iPart+nPart );
-        
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) 
-        dest_parts.short_prop[iprop]->insert( dest_parts.short_prop[iprop]->begin() + dest_id, short_prop[iprop]->begin()+iPart, short_prop[iprop]->begin()+iPart+nPart );
- 
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) 
-        dest_parts.uint64_prop[iprop]->insert( dest_parts.uint64_prop[iprop]->begin() + dest_id, uint64_prop[iprop]->begin()+iPart, uint64_prop[iprop]->begin()+iPart+nPart );
-
+    unsigned int nMove = dest_parts.size() - dest_id;
+    dest_parts.grow( dest_parts.size()+nPart );
+    
+    dest_parts.properties.move( dest_id, dest_id+nPart, nMove );
+    dest_parts.properties.copy( properties, iPart, dest_id, nPart );
+    
+    dest_parts.nParticles_ += nPart;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -228,15 +315,7 @@ void Particles::cp_particles(unsigned int iPart, unsigned int nPart, Particles &
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::erase_particle(unsigned int ipart )
 {
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) 
-        (*double_prop[iprop]).erase( (*double_prop[iprop]).begin()+ipart );
-            
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) 
-        (*short_prop[iprop]).erase( (*short_prop[iprop]).begin()+ipart );
-
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) 
-        (*uint64_prop[iprop]).erase( (*uint64_prop[iprop]).begin()+ipart );
-
+    erase_particle( ipart, 1 );
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -244,30 +323,18 @@ void Particles::erase_particle(unsigned int ipart )
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::erase_particle_trail(unsigned int ipart)
 {
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) 
-        (*double_prop[iprop]).erase( (*double_prop[iprop]).begin()+ipart, (*double_prop[iprop]).end() );
-            
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) 
-        (*short_prop[iprop]).erase( (*short_prop[iprop]).begin()+ipart, (*short_prop[iprop]).end() );
-
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) 
-        (*uint64_prop[iprop]).erase( (*uint64_prop[iprop]).begin()+ipart, (*uint64_prop[iprop]).end() );
-
+    nParticles_ = ipart;
 }
 // ---------------------------------------------------------------------------------------------------------------------
 // Suppress npart particles from ipart  
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::erase_particle(unsigned int ipart, unsigned int npart)
 {
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) 
-        (*double_prop[iprop]).erase( (*double_prop[iprop]).begin()+ipart, (*double_prop[iprop]).begin()+ipart+npart );
-            
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) 
-        (*short_prop[iprop]).erase( (*short_prop[iprop]).begin()+ipart, (*short_prop[iprop]).begin()+ipart+npart );
-
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) 
-        (*uint64_prop[iprop]).erase( (*uint64_prop[iprop]).begin()+ipart, (*uint64_prop[iprop]).begin()+ipart+npart );
+    unsigned int nMove = nParticles_ - ipart - npart;
+    
+    properties.move( ipart+npart, ipart, nMove );
     
+    nParticles_ -= npart;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -276,7 +343,6 @@ void Particles::erase_particle(unsigned int ipart, unsigned int npart)
 void Particles::print(unsigned int iPart) {
     for (unsigned int i=0; i<Position.size(); i++) {
         cout << Position[i][iPart] << " ";
-        //cout << Position_old[i][iPart] << " ";
     }
     for (unsigned int i=0; i<3; i++)
         cout << Momentum[i][iPart] << " ";
@@ -295,11 +361,10 @@ void Particles::print(unsigned int iPart) {
 // Print parameters of particle iPart
 // ---------------------------------------------------------------------------------------------------------------------
 ostream& operator << (ostream& out, const Particles& particles) {
-    for (unsigned int iPart=0;iPart<particles.Weight.size();iPart++) {
+    for (unsigned int iPart=0;iPart<particles.size();iPart++) {
         
         for (unsigned int i=0; i<particles.Position.size(); i++) {
             out << particles.Position[i][iPart] << " ";
-            //out << particles.Position_old[i][iPart] << " ";
         }
         for (unsigned int i=0; i<3; i++)
             out << particles.Momentum[i][iPart] << " ";
@@ -322,14 +387,7 @@ ostream& operator << (ostream& out, const Particles& particles) {
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::swap_part(unsigned int part1, unsigned int part2)
 {
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) 
-        std::swap( (*double_prop[iprop])[part1], (*double_prop[iprop])[part2] );
-
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ )
-        std::swap( (*short_prop[iprop])[part1], (*short_prop[iprop])[part2] );
-
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ )
-        std::swap( (*uint64_prop[iprop])[part1], (*uint64_prop[iprop])[part2] );
+    properties.swap( part1, part2 );
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -337,14 +395,7 @@ void Particles::swap_part(unsigned int part1, unsigned int part2)
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::overwrite_part(unsigned int part1, unsigned int part2)
 {
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ )
-        (*double_prop[iprop])[part2] = (*double_prop[iprop])[part1];
-    
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ )
-        (*short_prop[iprop])[part2] = (*short_prop[iprop])[part1];
-
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ )
-        (*uint64_prop[iprop])[part2] = (*uint64_prop[iprop])[part1];
+    properties.move( part1, part2 );
 }
 
 
@@ -353,18 +404,7 @@ void Particles::overwrite_part(unsigned int part1, unsigned int part2)
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::overwrite_part(unsigned int part1, unsigned int part2, unsigned int N)
 {
-    unsigned int sizepart = N*sizeof(Position[0][0]);
-    unsigned int sizecharge = N*sizeof(Charge[0]);
-    unsigned int sizeid = N*sizeof(Id[0]);
-
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ )
-        memcpy(& (*double_prop[iprop])[part2],  &(*double_prop[iprop])[part1], sizepart);
-
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ )
-        memcpy(& (*short_prop[iprop])[part2] ,  &(*short_prop[iprop])[part1] , sizecharge);
-    
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ )
-        memcpy(& (*uint64_prop[iprop])[part2]  ,  &(*uint64_prop[iprop])[part1]  , sizeid);
+    properties.move( part1, part2, N );
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -372,14 +412,7 @@ void Particles::overwrite_part(unsigned int part1, unsigned int part2, unsigned
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::overwrite_part(unsigned int part1, Particles &dest_parts, unsigned int part2)
 {
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) 
-        (*dest_parts.double_prop[iprop])[part2] = (*double_prop[iprop])[part1];
-        
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) 
-        (*dest_parts.short_prop[iprop])[part2] = (*short_prop[iprop])[part1];
-        
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) 
-        (*dest_parts.uint64_prop[iprop])[part2] = (*uint64_prop[iprop])[part1];
+    dest_parts.properties.copy( properties, part1, part2 );
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -387,19 +420,15 @@ void Particles::overwrite_part(unsigned int part1, Particles &dest_parts, unsign
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::overwrite_part(unsigned int part1, Particles &dest_parts, unsigned int part2, unsigned int N)
 {
-    unsigned int sizepart = N*sizeof(Position[0][0]);
-    unsigned int sizecharge = N*sizeof(Charge[0]);
-    unsigned int sizeid = N*sizeof(Id[0]);
-
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ )
-        memcpy(& (*dest_parts.double_prop[iprop])[part2],  &(*double_prop[iprop])[part1], sizepart);
+    dest_parts.properties.copy( properties, part1, part2, N );
+}
 
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ )
-        memcpy(& (*dest_parts.short_prop[iprop])[part2] ,  &(*short_prop[iprop])[part1] , sizecharge);
-    
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ )
-        memcpy(& (*dest_parts.uint64_prop[iprop])[part2]  ,  &(*uint64_prop[iprop])[part1]  , sizeid);
-    
+// ---------------------------------------------------------------------------------------------------------------------
+// Move each particle ipart into dest_part[ipart] memory location of dest vector (permutation of all the particles)
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::overwrite_part(Particles &dest_parts, const unsigned int* dest_part)
+{
+    dest_parts.properties.scatter( properties, dest_part, size() );
 }
 
 
@@ -408,30 +437,7 @@ void Particles::overwrite_part(unsigned int part1, Particles &dest_parts, unsign
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::swap_part(unsigned int part1, unsigned int part2, unsigned int N)
 {
-    double* buffer[N];
-    
-    unsigned int sizepart = N*sizeof(Position[0][0]);
-    unsigned int sizecharge = N*sizeof(Charge[0]);
-    unsigned int sizeid = N*sizeof(Id[0]);
-    
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) {
-        memcpy(buffer,&((*double_prop[iprop])[part1]), sizepart);
-        memcpy(&((*double_prop[iprop])[part1]), &((*double_prop[iprop])[part2]), sizepart);
-        memcpy(&((*double_prop[iprop])[part2]), buffer, sizepart);
-    }
-
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
-        memcpy(buffer,&((*short_prop[iprop])[part1]), sizecharge);
-        memcpy(&((*short_prop[iprop])[part1]), &((*short_prop[iprop])[part2]), sizecharge);
-        memcpy(&((*short_prop[iprop])[part2]), buffer, sizecharge);
-    }
-    
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) {
-        memcpy(buffer,&((*uint64_prop[iprop])[part1]), sizeid);
-        memcpy(&((*uint64_prop[iprop])[part1]), &((*uint64_prop[iprop])[part2]), sizeid);
-        memcpy(&((*uint64_prop[iprop])[part2]), buffer, sizeid);
-    }
-    
+    properties.swap( part1, part2, N );
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -447,40 +453,20 @@ void Particles::push_to_end(unsigned int iPart )
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::create_particle()
 {
-    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ )
-        (*double_prop[iprop]).push_back(0.);
+    unsigned int ipart = size();
+    grow( ipart+1 );
+    nParticles_++;
     
-    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ )
-        (*short_prop[iprop]).push_back(0);
-
-    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ )
-        (*uint64_prop[iprop]).push_back(0);
+    properties.zero( ipart, 1 );
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Create nParticles new particles at the end of vectors
 // ---------------------------------------------------------------------------------------------------------------------
-//void Particles::create_particles(int nAdditionalParticles )
-//{
-//    int nParticles = size();
-//    for (unsigned int i=0; i<Position.size(); i++) {
-//        Position[i].resize(nParticles+nAdditionalParticles,0.);
-//        Position_old[i].resize(nParticles+nAdditionalParticles,0.);
-//    }
-//    
-//    for (unsigned int i=0; i<3; i++) {
-//        Momentum[i].resize(nParticles+nAdditionalParticles,0.);
-//    }
-//    Weight.resize(nParticles+nAdditionalParticles,0.);
-//    Charge.resize(nParticles+nAdditionalParticles,0);
-//    
-//    if (tracked)
-//        Id.resize(nParticles+nAdditionalParticles,0);
-//    
-//    if (isRadReaction)
-//        Chi.resize(nParticles+nAdditionalParticles,0.);
-//
-//}
+void Particles::create_particles(unsigned int nAdditionalParticles)
+{
+    resize( size()+nAdditionalParticles, Position.size() );
+}
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Test if ipart is in the local patch
@@ -495,26 +481,61 @@ bool Particles::is_part_in_domain(unsigned int ipart, Patch* patch)
 }
 
 
-void Particles::sortById() {
-    if (!tracked) {
-        ERROR("Impossible");
+// ---------------------------------------------------------------------------------------------------------------------
+// Order the list of particle indices by increasing Id (stable LSD radix sort, 11 or 16 bits per pass)
+// The Ids are gathered once and move with the indices. A pass is skipped when all the Ids share its digit,
+// which is the case of the upper bits for the Ids given by one MPI process. Below radix_sort_min_size
+// indices, the fixed cost of the histograms exceeds that of a comparison sort, which is used instead.
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::radixSortById( vector<unsigned int>& index ) const
+{
+    const unsigned int radix_sort_min_size = 256;
+    
+    unsigned int n = index.size();
+    if ( n<2 ) return;
+    
+    if ( n<radix_sort_min_size ) {
+        vector<pair<uint64_t, unsigned int> > key_index(n);
+        for ( unsigned int i=0 ; i<n ; i++ )
+            key_index[i] = make_pair( Id[index[i]], index[i] );
+        sort( key_index.begin(), key_index.end() );
+        for ( unsigned int i=0 ; i<n ; i++ )
+            index[i] = key_index[i].second;
         return;
     }
-    int nParticles(Weight.size());
-    
-    bool stop;
-    int jPart(0);
-    do {
-        stop = true;
-        for ( int iPart = nParticles-1 ; iPart > jPart ; --iPart ) {
-            if ( Id[iPart] < Id[iPart-1] ) {
-                swap_part(iPart,jPart);
-                stop = false;
-            }
-        }
-        jPart++;
-    } while(!stop);
     
+    // wider digits when the list is long enough to amortize the larger histogram
+    const unsigned int radix_bits = n < (1<<16) ? 11 : 16;
+    const unsigned int radix_size = 1<<radix_bits;
+    const uint64_t radix_mask = radix_size-1;
+    
+    vector<uint64_t> key(n), key_tmp(n);
+    vector<unsigned int> index_tmp(n);
+    vector<unsigned int> count(radix_size+1);
+    // bits that differ between the Ids: the passes on the other digits are skipped
+    uint64_t differing_bits = 0;
+    for ( unsigned int i=0 ; i<n ; i++ ) {
+        key[i] = Id[index[i]];
+        differing_bits |= key[i] ^ key[0];
+    }
+    
+    for ( unsigned int shift=0 ; shift<64 ; shift+=radix_bits ) {
+        if ( ( (differing_bits>>shift) & radix_mask ) == 0 ) continue;
+        // histogram of the digit, shifted by one to get the start of each digit after the cumulative sum
+        count.assign( radix_size+1, 0 );
+        for ( unsigned int i=0 ; i<n ; i++ )
+            count[ ((key[i]>>shift)&radix_mask) + 1 ]++;
+        for ( unsigned int digit=0 ; digit<radix_size ; digit++ )
+            count[digit+1] += count[digit];
+        
+        for ( unsigned int i=0 ; i<n ; i++ ) {
+            unsigned int j = count[ (key[i]>>shift)&radix_mask ]++;
+            key_tmp  [j] = key  [i];
+            index_tmp[j] = index[i];
+        }
+        key.swap( key_tmp );
+        index.swap( index_tmp );
+    }
 }
 
 //bool Particles::test_move( int iPartStart, int iPartEnd, Params& params )
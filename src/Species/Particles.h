@@ -2,10 +2,12 @@
 #define PARTICLES_H
 
 #include <cmath>
+#include <cstring>
 
 #include <iostream>
 #include <fstream>
 #include <vector>
+#include <algorithm>
 
 #include "Tools.h"
 #include "TimeSelection.h"
@@ -17,6 +19,283 @@ class Patch;
 
 
 
+//----------------------------------------------------------------------------------------------------------------------
+//! ParticleProperty class: view on one particle property (x, px, weight, charge ...) stored in the Particles arena
+//! It behaves as a fixed-size array, the storage itself being managed by the owning Particles
+//----------------------------------------------------------------------------------------------------------------------
+template<typename T>
+class ParticleProperty {
+public:
+    ParticleProperty() : data_(NULL), size_(&no_particle) {}
+    
+    inline T& operator[]( unsigned int ipart )             { return data_[ipart]; }
+    inline const T& operator[]( unsigned int ipart ) const { return data_[ipart]; }
+    
+    //! Number of particles (shared by all the properties of the owning Particles)
+    inline unsigned int size() const { return *size_; }
+    
+    inline T* data()              { return data_; }
+    inline const T* data() const  { return data_; }
+    inline T* begin()             { return data_; }
+    inline const T* begin() const { return data_; }
+    inline T* end()               { return data_ + *size_; }
+    inline const T* end() const   { return data_ + *size_; }
+    inline T& back()              { return data_[*size_-1]; }
+    
+    //! Start of this property in the arena (set by Particles::bind_properties)
+    T* data_;
+    //! Number of particles of the owning Particles
+    const unsigned int* size_;
+    
+private:
+    //! Size of a property not (yet) stored in an arena
+    static const unsigned int no_particle;
+};
+
+template<typename T> const unsigned int ParticleProperty<T>::no_particle = 0;
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//! ParticleRealRef class: reference on one real value (position, momentum, weight) of one particle,
+//! whatever the precision it is stored in. It reads and writes as a double.
+//----------------------------------------------------------------------------------------------------------------------
+class ParticleRealRef {
+public:
+    explicit ParticleRealRef( double* d ) : d_(d), f_(NULL) {}
+    explicit ParticleRealRef( float*  f ) : d_(NULL), f_(f) {}
+    
+    inline operator double() const { return d_ ? *d_ : (double)(*f_); }
+    
+    inline ParticleRealRef& operator=( double value ) {
+        if (d_) *d_ = value;
+        else    *f_ = value;
+        return *this;
+    }
+    inline ParticleRealRef& operator=( const ParticleRealRef& ref ) { return *this = (double)ref; }
+    inline ParticleRealRef& operator+=( double value ) { return *this = (double)*this + value; }
+    inline ParticleRealRef& operator-=( double value ) { return *this = (double)*this - value; }
+    inline ParticleRealRef& operator*=( double value ) { return *this = (double)*this * value; }
+    inline ParticleRealRef& operator/=( double value ) { return *this = (double)*this / value; }
+    
+private:
+    double* d_;
+    float*  f_;
+};
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//! ParticleRealProperty class: view on one real particle property (position, momentum, weight)
+//! It is stored in double precision (d), or in single precision (f) for species with precision="single".
+//! Only one of the two views is bound to the arena.
+//----------------------------------------------------------------------------------------------------------------------
+class ParticleRealProperty {
+public:
+    ParticleRealProperty() : single(false) {}
+    
+    inline ParticleRealRef operator[]( unsigned int ipart ) {
+        return single ? ParticleRealRef( f.data_+ipart ) : ParticleRealRef( d.data_+ipart );
+    }
+    inline double operator[]( unsigned int ipart ) const {
+        return single ? (double)f.data_[ipart] : d.data_[ipart];
+    }
+    
+    inline unsigned int size() const { return single ? f.size() : d.size(); }
+    inline ParticleRealRef back() { return (*this)[size()-1]; }
+    
+    //! Raw storage, T must be the storage type (double, or float if single)
+    template<typename T> inline T* data();
+    
+    //! Address of the storage, whatever its type
+    inline void* address() { return single ? (void*)f.data_ : (void*)d.data_; }
+    
+    //! Double precision view
+    ParticleProperty<double> d;
+    //! Single precision view
+    ParticleProperty<float > f;
+    //! True if stored in single precision
+    bool single;
+};
+
+template<> inline double* ParticleRealProperty::data<double>() { return d.data_; }
+template<> inline float*  ParticleRealProperty::data<float >() { return f.data_; }
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//! ParticlePropertyList class: all the properties of type T of a Particles.
+//! They are stored one after the other in the arena, each one holding capacity particles : property k of particle
+//! ipart is base_[k*stride_+ipart]. The copy and move kernels use this layout directly, without going through the
+//! views of the properties.
+//----------------------------------------------------------------------------------------------------------------------
+template<typename T>
+class ParticlePropertyList {
+public:
+    ParticlePropertyList() : base_(NULL), stride_(0) {}
+    
+    //! Number of properties of type T
+    inline unsigned int size() const { return props_.size(); }
+    inline bool empty() const { return props_.empty(); }
+    inline ParticleProperty<T>* operator[]( unsigned int iprop ) const { return props_[iprop]; }
+    
+    inline void push_back( ParticleProperty<T>* prop ) { props_.push_back( prop ); }
+    inline void clear() {
+        props_.clear();
+        base_   = NULL;
+        stride_ = 0;
+    }
+    
+    //! Memory used by one particle
+    inline size_t bytes_per_particle() const { return props_.size()*sizeof(T); }
+    
+    //! Bind the properties to the arena from start, each one holding capacity particles. start is moved after them.
+    inline void bind( char* &start, unsigned int capacity, const unsigned int* nParticles ) {
+        base_   = (T*)start;
+        stride_ = capacity;
+        for ( unsigned int iprop=0 ; iprop<props_.size() ; iprop++ ) {
+            props_[iprop]->data_ = base_ + iprop*stride_;
+            props_[iprop]->size_ = nParticles;
+        }
+        start += props_.size()*capacity*sizeof(T);
+    }
+    
+    //! Copy the nParticles first particles to a new arena from dest, each property holding capacity particles
+    inline void relocate( char* &dest, unsigned int capacity, unsigned int nParticles ) const {
+        for ( unsigned int iprop=0 ; iprop<props_.size() ; iprop++ )
+            if ( nParticles>0 ) memcpy( (T*)dest + iprop*capacity, base_ + iprop*stride_, nParticles*sizeof(T) );
+        dest += props_.size()*capacity*sizeof(T);
+    }
+    
+    //! Copy particles src_part->src_part+N of src into dest_part->dest_part+N
+    inline void copy( const ParticlePropertyList<T>& src, unsigned int src_part, unsigned int dest_part, unsigned int N ) {
+        for ( unsigned int iprop=0 ; iprop<props_.size() ; iprop++ )
+            memcpy( base_ + iprop*stride_ + dest_part, src.base_ + iprop*src.stride_ + src_part, N*sizeof(T) );
+    }
+    //! Copy particle src_part of src into dest_part
+    inline void copy( const ParticlePropertyList<T>& src, unsigned int src_part, unsigned int dest_part ) {
+        for ( unsigned int iprop=0 ; iprop<props_.size() ; iprop++ )
+            base_[iprop*stride_ + dest_part] = src.base_[iprop*src.stride_ + src_part];
+    }
+    
+    //! Move particles src_part->src_part+N into dest_part->dest_part+N (the two ranges may overlap)
+    inline void move( unsigned int src_part, unsigned int dest_part, unsigned int N ) {
+        for ( unsigned int iprop=0 ; iprop<props_.size() ; iprop++ )
+            memmove( base_ + iprop*stride_ + dest_part, base_ + iprop*stride_ + src_part, N*sizeof(T) );
+    }
+    //! Move particle src_part into dest_part
+    inline void move( unsigned int src_part, unsigned int dest_part ) {
+        for ( unsigned int iprop=0 ; iprop<props_.size() ; iprop++ )
+            base_[iprop*stride_ + dest_part] = base_[iprop*stride_ + src_part];
+    }
+    
+    //! Exchange particles part1->part1+N and part2->part2+N
+    inline void swap( unsigned int part1, unsigned int part2, unsigned int N ) {
+        for ( unsigned int iprop=0 ; iprop<props_.size() ; iprop++ )
+            std::swap_ranges( base_ + iprop*stride_ + part1, base_ + iprop*stride_ + part1 + N, base_ + iprop*stride_ + part2 );
+    }
+    //! Exchange particles part1 and part2
+    inline void swap( unsigned int part1, unsigned int part2 ) {
+        for ( unsigned int iprop=0 ; iprop<props_.size() ; iprop++ )
+            std::swap( base_[iprop*stride_ + part1], base_[iprop*stride_ + part2] );
+    }
+    
+    //! Copy each particle ipart<N of src into dest_part[ipart] (property by property, reading src sequentially)
+    inline void scatter( const ParticlePropertyList<T>& src, const unsigned int* dest_part, unsigned int N ) {
+        for ( unsigned int iprop=0 ; iprop<props_.size() ; iprop++ ) {
+            const T* from = src.base_ + iprop*src.stride_;
+            T* to = base_ + iprop*stride_;
+            for ( unsigned int ipart=0 ; ipart<N ; ipart++ )
+                to[dest_part[ipart]] = from[ipart];
+        }
+    }
+    
+    //! Set particles ipart->ipart+N to zero
+    inline void zero( unsigned int ipart, unsigned int N ) {
+        for ( unsigned int iprop=0 ; iprop<props_.size() ; iprop++ )
+            memset( base_ + iprop*stride_ + ipart, 0, N*sizeof(T) );
+    }
+    
+private:
+    //! Views bound to the arena
+    std::vector< ParticleProperty<T>* > props_;
+    //! Start of the first property of type T in the arena
+    T* base_;
+    //! Capacity of each property (distance between two properties)
+    unsigned int stride_;
+};
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//! ParticlePropertyRegistry class: one ParticlePropertyList per type, in the order of the arena.
+//! The set of types is fixed at compile time, so that each operation on a particle is unrolled over the types, and
+//! only the properties actually defined for the species are stored and copied.
+//----------------------------------------------------------------------------------------------------------------------
+template<typename... Types>
+class ParticlePropertyRegistry;
+
+template<>
+class ParticlePropertyRegistry<> {
+public:
+    inline size_t bytes_per_particle() const { return 0; }
+    inline void clear() {}
+    inline void bind( char* &, unsigned int, const unsigned int* ) {}
+    inline void relocate( char* &, unsigned int, unsigned int ) const {}
+    inline void copy( const ParticlePropertyRegistry<>&, unsigned int, unsigned int, unsigned int ) {}
+    inline void copy( const ParticlePropertyRegistry<>&, unsigned int, unsigned int ) {}
+    inline void move( unsigned int, unsigned int, unsigned int ) {}
+    inline void move( unsigned int, unsigned int ) {}
+    inline void swap( unsigned int, unsigned int, unsigned int ) {}
+    inline void swap( unsigned int, unsigned int ) {}
+    inline void scatter( const ParticlePropertyRegistry<>&, const unsigned int*, unsigned int ) {}
+    inline void zero( unsigned int, unsigned int ) {}
+};
+
+template<typename T, typename... Rest>
+class ParticlePropertyRegistry<T, Rest...> : public ParticlePropertyList<T>, public ParticlePropertyRegistry<Rest...> {
+    typedef ParticlePropertyList<T> List;
+    typedef ParticlePropertyRegistry<Rest...> Next;
+public:
+    //! List of the properties of type U
+    template<typename U> inline ParticlePropertyList<U>& list() { return *this; }
+    template<typename U> inline const ParticlePropertyList<U>& list() const { return *this; }
+    
+    inline size_t bytes_per_particle() const {
+        return List::bytes_per_particle() + Next::bytes_per_particle();
+    }
+    inline void clear() {
+        List::clear(); Next::clear();
+    }
+    inline void bind( char* &start, unsigned int capacity, const unsigned int* nParticles ) {
+        List::bind( start, capacity, nParticles ); Next::bind( start, capacity, nParticles );
+    }
+    inline void relocate( char* &dest, unsigned int capacity, unsigned int nParticles ) const {
+        List::relocate( dest, capacity, nParticles ); Next::relocate( dest, capacity, nParticles );
+    }
+    inline void copy( const ParticlePropertyRegistry& src, unsigned int src_part, unsigned int dest_part, unsigned int N ) {
+        List::copy( src, src_part, dest_part, N ); Next::copy( src, src_part, dest_part, N );
+    }
+    inline void copy( const ParticlePropertyRegistry& src, unsigned int src_part, unsigned int dest_part ) {
+        List::copy( src, src_part, dest_part ); Next::copy( src, src_part, dest_part );
+    }
+    inline void move( unsigned int src_part, unsigned int dest_part, unsigned int N ) {
+        List::move( src_part, dest_part, N ); Next::move( src_part, dest_part, N );
+    }
+    inline void move( unsigned int src_part, unsigned int dest_part ) {
+        List::move( src_part, dest_part ); Next::move( src_part, dest_part );
+    }
+    inline void swap( unsigned int part1, unsigned int part2, unsigned int N ) {
+        List::swap( part1, part2, N ); Next::swap( part1, part2, N );
+    }
+    inline void swap( unsigned int part1, unsigned int part2 ) {
+        List::swap( part1, part2 ); Next::swap( part1, part2 );
+    }
+    inline void scatter( const ParticlePropertyRegistry& src, const unsigned int* dest_part, unsigned int N ) {
+        List::scatter( src, dest_part, N ); Next::scatter( src, dest_part, N );
+    }
+    inline void zero( unsigned int ipart, unsigned int N ) {
+        List::zero( ipart, N ); Next::zero( ipart, N );
+    }
+};
+
+
 //----------------------------------------------------------------------------------------------------------------------
 //! Particle class: holds the basic properties of a particle
 //----------------------------------------------------------------------------------------------------------------------
@@ -26,8 +305,14 @@ public:
     //! Constructor for Particle
     Particles();
     
+    //! Copy constructor for Particle (the arena is duplicated)
+    Particles( const Particles& part );
+    
+    //! Assignment operator (the arena is duplicated)
+    Particles& operator=( const Particles& part );
+    
     //! Destructor for Particle
-    ~Particles(){}
+    ~Particles();
     
     //! Create nParticles null particles of nDim size
     void initialize(unsigned int nParticles, unsigned int nDim );
@@ -44,17 +329,20 @@ public:
     //! Remove extra capacity of Particles vectors
     void shrink_to_fit( unsigned int nDim );
     
+    //! Move the arena to memory first touched by the calling thread (NUMA placement)
+    void firstTouch();
+    
     //! Reset Particles vectors
     void clear();
     
     //! Get number of particules
     inline unsigned int size() const {
-        return Weight.size();
+        return nParticles_;
     }
     
     //! Get number of particules
     inline unsigned int capacity() const {
-        return Weight.capacity();
+        return capacity_;
     }
     
     //! Get dimension of particules
@@ -101,6 +389,9 @@ public:
     //! Overwrite particle part1 into part2 of dest_parts memory location. Erasing part2
     void overwrite_part(unsigned int part1, Particles &dest_parts, unsigned int part2);
     
+    //! Overwrite each particle ipart into dest_part[ipart] of dest_parts memory location (all the particles are copied)
+    void overwrite_part(Particles &dest_parts, const unsigned int* dest_part);
+    
     
     //! Move iPart at the end of vectors
     void push_to_end(unsigned int iPart );
@@ -119,22 +410,13 @@ public:
         return Position[idim][ipart];
     }
     //! Method used to set a new value to the Particle former position
-    inline double& position( unsigned int idim, unsigned int ipart )       {
+    inline ParticleRealRef position( unsigned int idim, unsigned int ipart )       {
         return Position[idim][ipart];
     }
     
-    //! Method used to get the Particle position
-    inline double  position_old( unsigned int idim, unsigned int ipart ) const {
-        return Position_old[idim][ipart];
-    }
-    //! Method used to set a new value to the Particle former position
-    inline double& position_old( unsigned int idim, unsigned int ipart )       {
-        return Position_old[idim][ipart];
-    }
-    
     //! Method used to get the list of Particle position
     inline std::vector<double>  position(unsigned int idim) const {
-        return Position[idim];
+        return real_vector( Position[idim] );
     }
     
     //! Method used to get the Particle momentum
@@ -142,12 +424,12 @@ public:
         return Momentum[idim][ipart];
     }
     //! Method used to set a new value to the Particle momentum
-    inline double& momentum( unsigned int idim, unsigned int ipart )       {
+    inline ParticleRealRef momentum( unsigned int idim, unsigned int ipart )       {
         return Momentum[idim][ipart];
     }
       //! Method used to get the Particle momentum
     inline std::vector<double>  momentum( unsigned int idim ) const {
-        return Momentum[idim];
+        return real_vector( Momentum[idim] );
     }
     
     //! Method used to get the Particle weight
@@ -155,12 +437,12 @@ public:
         return Weight[ipart];
     }
     //! Method used to set a new value to the Particle weight
-    inline double& weight(unsigned int ipart)       {
+    inline ParticleRealRef weight(unsigned int ipart)       {
         return Weight[ipart];
     }
     //! Method used to get the Particle weight
     inline std::vector<double>  weight() const {
-        return Weight;
+        return real_vector( Weight );
     }
     
     //! Method used to get the Particle charge
@@ -173,38 +455,37 @@ public:
     }
     //! Method used to get the list of Particle charges
     inline std::vector<short>  charge() const {
-        return Charge;
+        return std::vector<short>( Charge.begin(), Charge.end() );
     }
     
     
     //! Method used to get the Particle Lorentz factor
     inline double lor_fac(unsigned int ipart) {
-        return sqrt(1.+pow(momentum(0,ipart),2)+pow(momentum(1,ipart),2)+pow(momentum(2,ipart),2));
+        double px = momentum(0,ipart), py = momentum(1,ipart), pz = momentum(2,ipart);
+        return sqrt(1.+pow(px,2)+pow(py,2)+pow(pz,2));
     }
     
-    //! Partiles properties, respect type order : all double, all short, all unsigned int
+    //! Partiles properties, respect type order : all double, all float, all short, all unsigned int
+    //! All of them live in a single arena, see bind_properties
     
     //! array containing the particle position
-    std::vector< std::vector<double> > Position;
-    
-    //! array containing the particle former (old) positions
-    std::vector< std::vector<double> >Position_old;
+    std::vector< ParticleRealProperty > Position;
     
     //! array containing the particle moments
-    std::vector< std::vector<double> >  Momentum;
+    std::vector< ParticleRealProperty > Momentum;
     
     //! containing the particle weight: equivalent to a charge density
-    std::vector<double> Weight;
+    ParticleRealProperty Weight;
     
     //! containing the particle weight: equivalent to a charge density
-    std::vector<double> Chi;
+    ParticleProperty<double> Chi;
     
     
     //! charge state of the particle (multiples of e>0)
-    std::vector<short> Charge;
+    ParticleProperty<short> Charge;
     
     //! Id of the particle
-    std::vector<uint64_t> Id;
+    ParticleProperty<uint64_t> Id;
     
     // TEST PARTICLE PARAMETERS
     bool isTest;
@@ -213,13 +494,13 @@ public:
     bool tracked;
     
     void resetIds() {
-        unsigned int s = Id.size();
+        unsigned int s = size();
         for (unsigned int iPart=0; iPart<s; iPart++) Id[iPart] = 0;
     }
     
     //! Method used to get the Particle Id
     inline uint64_t id(unsigned int ipart) const {
-        DEBUG(ipart << " of " << Id.size());
+        DEBUG(ipart << " of " << size());
         return Id[ipart];
     }
     //! Method used to set the Particle Id
@@ -228,9 +509,10 @@ public:
     }
     //! Method used to get the Particle Ids
     inline std::vector<uint64_t> id() const {
-        return Id;
+        return std::vector<uint64_t>( Id.begin(), Id.end() );
     }
-    void sortById();
+    //! Order the list of particle indices index by increasing Id (radix sort)
+    void radixSortById( std::vector<unsigned int>& index ) const;
     
     
     // PARAMETERS FOR PARTICLES THAT ARE SUBMITTED TO A RADIATION REACTION FORCE (CED or QED)
@@ -238,6 +520,11 @@ public:
     bool isRadReaction;
     
     
+    // PRECISION "single" : POSITION, MOMENTUM AND WEIGHT ARE STORED AS FLOAT
+    
+    bool singlePrecision;
+    
+    
     //! Method used to get the Particle chi factor
     inline double  chi(unsigned int ipart) const {
         return Chi[ipart];
@@ -248,46 +535,129 @@ public:
     }
     //! Method used to get the Particle chi factor
     inline std::vector<double>  chi() const {
-        return Chi;
+        return std::vector<double>( Chi.begin(), Chi.end() );
     }
     
-    std::vector< std::vector<double  >*> double_prop;
-    std::vector< std::vector<short   >*> short_prop;
-    std::vector< std::vector<uint64_t>*> uint64_prop;
+    //! Registry of the properties stored in the arena, in the order of the arena
+    typedef ParticlePropertyRegistry<double, float, short, uint64_t> PropertyRegistry;
+    PropertyRegistry properties;
     
+    //! Lists of the properties of each type (in properties)
+    ParticlePropertyList<double  >& double_prop;
+    ParticlePropertyList<float   >& float_prop;
+    ParticlePropertyList<short   >& short_prop;
+    ParticlePropertyList<uint64_t>& uint64_prop;
     
-    //bool test_move( int iPartStart, int iPartEnd, Params& params );
-
-#ifdef __DEBUG
-    inline double dist2( unsigned int iPart ) {
-        double dist(0.);
-        for ( unsigned int iDim = 0 ; iDim < Position.size() ; iDim++ ) {
-            double delta = position(iDim,iPart)-position_old(iDim,iPart);
-            dist += delta*delta;
-        }
-        return dist;
-    }
-    inline double dist( unsigned int iPart, unsigned int iDim ) {
-        double delta = std::abs( position(iDim,iPart)-position_old(iDim,iPart) );
-        return delta;
+    //! Memory used by one particle in the arena
+    inline size_t bytes_per_particle() const {
+        return properties.bytes_per_particle();
     }
-#endif
     
+    
+    //bool test_move( int iPartStart, int iPartEnd, Params& params );
+
     Particle operator()(unsigned int iPart);
     
     //! Methods to obtain the any property, given its index in the arrays double_prop, uint64_prop, or short_prop
-    void getProperty(unsigned int iprop, std::vector<uint64_t>* &prop) {
+    //! Real properties are indexed as in real_prop, whatever their precision
+    void getProperty(unsigned int iprop, ParticleProperty<uint64_t>* &prop) {
         prop = uint64_prop[iprop];
     }
-    void getProperty(unsigned int iprop, std::vector<short>* &prop) {
+    void getProperty(unsigned int iprop, ParticleProperty<short>* &prop) {
         prop = short_prop[iprop];
     }
-    void getProperty(unsigned int iprop, std::vector<double>* &prop) {
+    void getProperty(unsigned int iprop, ParticleProperty<double>* &prop) {
         prop = double_prop[iprop];
     }
+    void getProperty(unsigned int iprop, ParticleRealProperty* &prop) {
+        prop = real_prop[iprop];
+    }
+    
+    //! Real properties (Position, Momentum, Weight ...) whatever their precision
+    std::vector< ParticleRealProperty* > real_prop;
+    
+    //! Address of the first property in the arena (base address of the MPI datatypes)
+    inline void* address() {
+        return arena_;
+    }
+    
+    //! Alignment (in bytes) of each property in the arena
+    static const unsigned int arena_alignment = 64;
     
 private:
+    //! Single block holding all the properties : property k starts at k*capacity_ elements of its type,
+    //! doubles first, then floats, shorts and uint64. capacity_ is a multiple of arena_alignment/sizeof(short)
+    //! so that each property starts on a cache line.
+    char* arena_;
+    
+    //! Number of particles
+    unsigned int nParticles_;
+    
+    //! Number of particles which fit in the arena
+    unsigned int capacity_;
+    
+    //! Build the list of properties (double_prop, float_prop, short_prop, uint64_prop)
+    void define_properties( unsigned int nDim );
+    
+    //! Add a real property to real_prop and to double_prop or float_prop, depending on the precision
+    //! (allowSingle=false keeps the property in double whatever the precision)
+    void add_real_property( ParticleRealProperty& prop, bool allowSingle=true );
+    
+    //! True once the properties are defined (Charge is always stored)
+    inline bool properties_defined() const {
+        return !short_prop.empty();
+    }
+    
+    //! Copy of a real property as a vector of doubles
+    inline std::vector<double> real_vector( const ParticleRealProperty& prop ) const {
+        std::vector<double> v( prop.size() );
+        for ( unsigned int ipart=0 ; ipart<prop.size() ; ipart++ )
+            v[ipart] = prop[ipart];
+        return v;
+    }
+    
+    //! Make every property point to its place in the arena
+    void bind_properties();
+    
+    //! Move the properties to a new arena able to hold n_part_max particles
+    void reallocate( unsigned int n_part_max );
+    
+    //! Ensure that nParticles particles fit in the arena, growing it geometrically
+    inline void grow( unsigned int nParticles ) {
+        if ( nParticles > capacity_ )
+            reallocate( std::max( nParticles, capacity_ + capacity_/2 ) );
+    }
+
+};
+
 
+//----------------------------------------------------------------------------------------------------------------------
+//! ParticleArrays class: raw arrays of the real properties of a Particles stored in precision real (the positions are
+//! always in double), with the read accessors of Particles. Kernels templated on real read the particles through it : the precision is tested once per
+//! call (particles.singlePrecision) instead of once per particle by ParticleRealProperty.
+//----------------------------------------------------------------------------------------------------------------------
+template<typename real>
+class ParticleArrays {
+public:
+    explicit ParticleArrays( Particles &particles ) {
+        for ( unsigned int i=0 ; i<3 ; i++ ) {
+            position_[i] = i<particles.dimension() ? particles.Position[i].data<double>() : NULL;
+            momentum_[i] = particles.Momentum[i].data<real>();
+        }
+        weight_ = particles.Weight.data<real>();
+        charge_ = particles.Charge.data();
+    }
+    
+    inline double position( unsigned int idim, unsigned int ipart ) const { return position_[idim][ipart]; }
+    inline real   momentum( unsigned int idim, unsigned int ipart ) const { return momentum_[idim][ipart]; }
+    inline real   weight  ( unsigned int ipart ) const { return weight_[ipart]; }
+    inline short  charge  ( unsigned int ipart ) const { return charge_[ipart]; }
+    
+private:
+    double* position_[3];
+    real* momentum_[3];
+    real* weight_;
+    short* charge_;
 };
 
 
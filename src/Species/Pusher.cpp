@@ -6,10 +6,13 @@ Pusher::Pusher(Params& params, Species *species)
 {
     mass_          = species->mass;
     one_over_mass_ = 1.0/mass_;
-    dt             = params.timestep;
-    dts2           = params.timestep/2.;
+    // A subcycled species is pushed with subcycle timesteps at once
+    dt             = params.timestep * species->subcycle;
+    dts2           = dt/2.;
 
     nDim_          = params.nDim_particle;
+    
+    singleArithmetic = species->push_precision=="single";
 
 }
 
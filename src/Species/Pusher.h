@@ -23,6 +23,8 @@ public:
 
 protected:
     double dt, dts2;
+    //! Momentum update done in single precision (Species::push_precision), for particles stored in double
+    bool singleArithmetic;
     //! \todo Move mass_ in Particles_
     // mass_ relative to Species but used in the particle pusher
     double mass_;
@@ -24,79 +24,160 @@ PusherBoris::~PusherBoris()
 
 void PusherBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    if (particles.singlePrecision)
+        push<float >(particles, smpi, istart, iend, ithread);
+    else if (singleArithmetic)
+        pushMixed(particles, smpi, istart, iend, ithread);
+    else
+        push<double>(particles, smpi, istart, iend, ithread);
+}
+
+template<typename real>
+void PusherBoris::push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    int nparts = smpi->dynamics_invgf[ithread].size();
+    double* Ex = smpi->dynamics_Epart[ithread].data();
+    double* Ey = Ex + nparts;
+    double* Ez = Ey + nparts;
+    double* Bx = smpi->dynamics_Bpart[ithread].data();
+    double* By = Bx + nparts;
+    double* Bz = By + nparts;
     std::vector<double> *invgf = &(smpi->dynamics_invgf[ithread]);
 
-    double charge_over_mass_dts2;
-    double umx, umy, umz, upx, upy, upz;
-    double alpha, inv_det_T, Tx, Ty, Tz, Tx2, Ty2, Tz2;
-    double TxTy, TyTz, TzTx;
-    double pxsm, pysm, pzsm;
-    double local_invgf;
+    const real one = 1.0, two = 2.0;
+    const real one_over_mass = one_over_mass_, dts2_r = dts2;
 
-    double* momentum[3];
+    real charge_over_mass_dts2;
+    real umx, umy, umz, upx, upy, upz;
+    real alpha, inv_det_T, Tx, Ty, Tz, Tx2, Ty2, Tz2;
+    real TxTy, TyTz, TzTx;
+    real pxsm, pysm, pzsm;
+    real local_invgf;
+
+    real* momentum[3];
     for ( int i = 0 ; i<3 ; i++ )
-        momentum[i] =  &( particles.momentum(i,0) );
+        momentum[i] =  particles.Momentum[i].data<real>();
     double* position[3];
     for ( int i = 0 ; i<nDim_ ; i++ )
-        position[i] =  &( particles.position(i,0) );
-#ifdef  __DEBUG
-    double* position_old[3];
-    for ( int i = 0 ; i<nDim_ ; i++ )
-        position_old[i] =  &( particles.position_old(i,0) );
-#endif
+        position[i] =  particles.Position[i].data<double>();
     short* charge = &( particles.charge(0) );
 
     #pragma omp simd
     for (int ipart=istart ; ipart<iend; ipart++ ) {
-        charge_over_mass_dts2 = (double)(charge[ipart])*one_over_mass_*dts2;
+        charge_over_mass_dts2 = (real)(charge[ipart])*one_over_mass*dts2_r;
 
         // init Half-acceleration in the electric field
-        pxsm = charge_over_mass_dts2*(*Epart)[ipart].x;
-        pysm = charge_over_mass_dts2*(*Epart)[ipart].y;
-        pzsm = charge_over_mass_dts2*(*Epart)[ipart].z;
+        pxsm = charge_over_mass_dts2*(real)Ex[ipart];
+        pysm = charge_over_mass_dts2*(real)Ey[ipart];
+        pzsm = charge_over_mass_dts2*(real)Ez[ipart];
 
         //(*this)(particles, ipart, (*Epart)[ipart], (*Bpart)[ipart] , (*invgf)[ipart]);
         umx = momentum[0][ipart] + pxsm;
         umy = momentum[1][ipart] + pysm;
         umz = momentum[2][ipart] + pzsm;
-        local_invgf = 1. / sqrt( 1.0 + umx*umx + umy*umy + umz*umz );
+        local_invgf = one / sqrt( one + umx*umx + umy*umy + umz*umz );
 
         // Rotation in the magnetic field
         alpha = charge_over_mass_dts2*local_invgf;
-        Tx    = alpha * (*Bpart)[ipart].x;
-        Ty    = alpha * (*Bpart)[ipart].y;
-        Tz    = alpha * (*Bpart)[ipart].z;
+        Tx    = alpha * (real)Bx[ipart];
+        Ty    = alpha * (real)By[ipart];
+        Tz    = alpha * (real)Bz[ipart];
         Tx2   = Tx*Tx;
         Ty2   = Ty*Ty;
         Tz2   = Tz*Tz;
         TxTy  = Tx*Ty;
         TyTz  = Ty*Tz;
         TzTx  = Tz*Tx;
-        inv_det_T = 1.0/(1.0+Tx2+Ty2+Tz2);
+        inv_det_T = one/(one+Tx2+Ty2+Tz2);
 
-        upx = (  (1.0+Tx2-Ty2-Tz2)* umx  +      2.0*(TxTy+Tz)* umy  +      2.0*(TzTx-Ty)* umz  )*inv_det_T;
-        upy = (      2.0*(TxTy-Tz)* umx  +  (1.0-Tx2+Ty2-Tz2)* umy  +      2.0*(TyTz+Tx)* umz  )*inv_det_T;
-        upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
+        upx = (  (one+Tx2-Ty2-Tz2)* umx  +      two*(TxTy+Tz)* umy  +      two*(TzTx-Ty)* umz  )*inv_det_T;
+        upy = (      two*(TxTy-Tz)* umx  +  (one-Tx2+Ty2-Tz2)* umy  +      two*(TyTz+Tx)* umz  )*inv_det_T;
+        upz = (      two*(TzTx+Ty)* umx  +      two*(TyTz-Tx)* umy  +  (one-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
 
         // finalize Half-acceleration in the electric field
         pxsm += upx;
         pysm += upy;
         pzsm += upz;
-        (*invgf)[ipart] = 1. / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        local_invgf = one / sqrt( one + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        (*invgf)[ipart] = local_invgf;
 
         momentum[0][ipart] = pxsm;
         momentum[1][ipart] = pysm;
         momentum[2][ipart] = pzsm;
 
-        // Move the particle
-#ifdef  __DEBUG
+        // Move the particle (always in double precision)
         for ( int i = 0 ; i<nDim_ ; i++ ) 
-          position_old[i][ipart] = position[i][ipart];
-#endif
+            position[i][ipart]     += dt*(double)momentum[i][ipart]*(double)local_invgf;
+
+    }
+}
+
+// Momentum stored in double, increment computed in float : the half accelerations and the rotation
+// u+ - u- = 2 [ T(u-.T) - T^2 u- + u- x T ] / (1+T^2) only involve small terms, whose float round-off is relative
+// to the increment and not to the momentum, which is accumulated in double
+void PusherBoris::pushMixed(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    int nparts = smpi->dynamics_invgf[ithread].size();
+    double* Ex = smpi->dynamics_Epart[ithread].data();
+    double* Ey = Ex + nparts;
+    double* Ez = Ey + nparts;
+    double* Bx = smpi->dynamics_Bpart[ithread].data();
+    double* By = Bx + nparts;
+    double* Bz = By + nparts;
+    std::vector<double> *invgf = &(smpi->dynamics_invgf[ithread]);
+
+    const float one = 1.0f, two = 2.0f;
+    const float one_over_mass = one_over_mass_, dts2_f = dts2;
+
+    float charge_over_mass_dts2;
+    float umx, umy, umz;
+    float alpha, Tx, Ty, Tz, T2, uT, rot;
+    float pxsm, pysm, pzsm;
+    double local_invgf;
+
+    double* momentum[3];
+    for ( int i = 0 ; i<3 ; i++ )
+        momentum[i] =  particles.Momentum[i].data<double>();
+    double* position[3];
+    for ( int i = 0 ; i<nDim_ ; i++ )
+        position[i] =  particles.Position[i].data<double>();
+    short* charge = &( particles.charge(0) );
+
+    #pragma omp simd
+    for (int ipart=istart ; ipart<iend; ipart++ ) {
+        charge_over_mass_dts2 = (float)(charge[ipart])*one_over_mass*dts2_f;
+
+        // init Half-acceleration in the electric field
+        pxsm = charge_over_mass_dts2*(float)Ex[ipart];
+        pysm = charge_over_mass_dts2*(float)Ey[ipart];
+        pzsm = charge_over_mass_dts2*(float)Ez[ipart];
+
+        umx = (float)momentum[0][ipart] + pxsm;
+        umy = (float)momentum[1][ipart] + pysm;
+        umz = (float)momentum[2][ipart] + pzsm;
+
+        // Rotation in the magnetic field
+        alpha = charge_over_mass_dts2 / sqrt( one + umx*umx + umy*umy + umz*umz );
+        Tx    = alpha * (float)Bx[ipart];
+        Ty    = alpha * (float)By[ipart];
+        Tz    = alpha * (float)Bz[ipart];
+        T2    = Tx*Tx + Ty*Ty + Tz*Tz;
+        uT    = umx*Tx + umy*Ty + umz*Tz;
+        rot   = two/(one+T2);
+
+        // Increment : both half accelerations and the rotation, accumulated in double
+        momentum[0][ipart] += (double)( two*pxsm + rot*( uT*Tx - T2*umx + umy*Tz - umz*Ty ) );
+        momentum[1][ipart] += (double)( two*pysm + rot*( uT*Ty - T2*umy + umz*Tx - umx*Tz ) );
+        momentum[2][ipart] += (double)( two*pzsm + rot*( uT*Tz - T2*umz + umx*Ty - umy*Tx ) );
+
+        local_invgf = 1. / sqrt( 1. + momentum[0][ipart]*momentum[0][ipart]
+                                     + momentum[1][ipart]*momentum[1][ipart]
+                                     + momentum[2][ipart]*momentum[2][ipart] );
+        (*invgf)[ipart] = local_invgf;
+
+        // Move the particle
         for ( int i = 0 ; i<nDim_ ; i++ ) 
-            position[i][ipart]     += dt*momentum[i][ipart]*(*invgf)[ipart];
+            position[i][ipart]     += dt*momentum[i][ipart]*local_invgf;
 
     }
 }
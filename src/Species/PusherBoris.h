@@ -21,6 +21,13 @@ public:
     //! Overloading of () operator
     virtual void operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
 
+private:
+    //! Push particles whose momentum is stored in the precision real (the positions are always in double)
+    template<typename real>
+    void push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
+    //! Push particles stored in double, with the momentum increment computed in single precision
+    void pushMixed(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
+
 };
 
 #endif
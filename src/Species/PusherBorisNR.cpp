@@ -22,8 +22,22 @@ PusherBorisNR::~PusherBorisNR()
 
 void PusherBorisNR::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    if (particles.singlePrecision)
+        push<float >(particles, smpi, istart, iend, ithread);
+    else
+        push<double>(particles, smpi, istart, iend, ithread);
+}
+
+template<typename real>
+void PusherBorisNR::push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    int nparts = smpi->dynamics_invgf[ithread].size();
+    double* Ex = smpi->dynamics_Epart[ithread].data();
+    double* Ey = Ex + nparts;
+    double* Ez = Ey + nparts;
+    double* Bx = smpi->dynamics_Bpart[ithread].data();
+    double* By = Bx + nparts;
+    double* Bz = By + nparts;
 
     double charge_over_mass_ ;
     double umx, umy, umz;
@@ -33,22 +47,30 @@ void PusherBorisNR::operator() (Particles &particles, SmileiMPI* smpi, int istar
     double T2;
     double Sx, Sy, Sz;
 
+    real* momentum[3];
+    for ( int i = 0 ; i<3 ; i++ )
+        momentum[i] =  particles.Momentum[i].data<real>();
+    double* position[3];
+    for ( int i = 0 ; i<nDim_ ; i++ )
+        position[i] =  particles.Position[i].data<double>();
+    short* charge = &( particles.charge(0) );
+
     for (int ipart=istart ; ipart<iend; ipart++ ) {
 
-        charge_over_mass_ = static_cast<double>(particles.charge(ipart))*one_over_mass_;
+        charge_over_mass_ = static_cast<double>(charge[ipart])*one_over_mass_;
         alpha = charge_over_mass_*dts2;
 
         // uminus = v + q/m * dt/2 * E
-        umx = particles.momentum(0, ipart) * one_over_mass_ + alpha * (*Epart)[ipart].x;
-        umy = particles.momentum(1, ipart) * one_over_mass_ + alpha * (*Epart)[ipart].y;
-        umz = particles.momentum(2, ipart) * one_over_mass_ + alpha * (*Epart)[ipart].z;
+        umx = momentum[0][ipart] * one_over_mass_ + alpha * Ex[ipart];
+        umy = momentum[1][ipart] * one_over_mass_ + alpha * Ey[ipart];
+        umz = momentum[2][ipart] * one_over_mass_ + alpha * Ez[ipart];
 
 
         // Rotation in the magnetic field
 
-        Tx    = alpha * (*Bpart)[ipart].x;
-        Ty    = alpha * (*Bpart)[ipart].y;
-        Tz    = alpha * (*Bpart)[ipart].z;
+        Tx    = alpha * Bx[ipart];
+        Ty    = alpha * By[ipart];
+        Tz    = alpha * Bz[ipart];
 
         T2 = Tx*Tx + Ty*Ty + Tz*Tz;
 
@@ -62,12 +84,12 @@ void PusherBorisNR::operator() (Particles &particles, SmileiMPI* smpi, int istar
         upz = umz + umx*Sy - umy*Sx;
 
 
-        particles.momentum(0, ipart) = mass_ * (upx + alpha*(*Epart)[ipart].x);
-        particles.momentum(1, ipart) = mass_ * (upy + alpha*(*Epart)[ipart].y);
-        particles.momentum(2, ipart) = mass_ * (upz + alpha*(*Epart)[ipart].z);
+        momentum[0][ipart] = mass_ * (upx + alpha*Ex[ipart]);
+        momentum[1][ipart] = mass_ * (upy + alpha*Ey[ipart]);
+        momentum[2][ipart] = mass_ * (upz + alpha*Ez[ipart]);
 
         // Move the particle
         for ( int i = 0 ; i<nDim_ ; i++ )
-            particles.position(i, ipart)     += dt*particles.momentum(i, ipart);
+            position[i][ipart]     += dt*momentum[i][ipart];
     }
 }
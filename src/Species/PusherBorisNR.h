@@ -22,6 +22,11 @@ public:
     //! Overriding operator()
     virtual void operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
 
+private:
+    //! Push particles stored in the precision real (the computation is done in double precision)
+    template<typename real>
+    void push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
+
 };
 
 #endif
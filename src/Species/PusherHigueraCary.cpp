@@ -32,28 +32,38 @@ PusherHigueraCary::~PusherHigueraCary()
 
 void PusherHigueraCary::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    if (singleArithmetic)
+        pushMixed(particles, smpi, istart, iend, ithread);
+    else
+        push(particles, smpi, istart, iend, ithread);
+}
+
+void PusherHigueraCary::push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    int nparts = smpi->dynamics_invgf[ithread].size();
+    double* Ex = smpi->dynamics_Epart[ithread].data();
+    double* Ey = Ex + nparts;
+    double* Ez = Ey + nparts;
+    double* Bx = smpi->dynamics_Bpart[ithread].data();
+    double* By = Bx + nparts;
+    double* Bz = By + nparts;
     std::vector<double> *invgf = &(smpi->dynamics_invgf[ithread]);
 
+    const double one = 1.0, two = 2.0, four = 4.0, half = 0.5;
+
     double charge_over_mass_dts2;
     double umx, umy, umz, upx, upy, upz, gfm2;
     double beta2, inv_det_T, Tx, Ty, Tz, Tx2, Ty2, Tz2;
     double TxTy, TyTz, TzTx;
     double pxsm, pysm, pzsm;
-    double local_invgf;
+    double local_invgf, sigma, uT;
 
     double* momentum[3];
     for ( int i = 0 ; i<3 ; i++ )
-        momentum[i] =  &( particles.momentum(i,0) );
+        momentum[i] =  particles.Momentum[i].data<double>();
     double* position[3];
     for ( int i = 0 ; i<nDim_ ; i++ )
-        position[i] =  &( particles.position(i,0) );
-#ifdef  __DEBUG
-    double* position_old[3];
-    for ( int i = 0 ; i<nDim_ ; i++ )
-        position_old[i] =  &( particles.position_old(i,0) );
-#endif
+        position[i] =  particles.Position[i].data<double>();
     short* charge = &( particles.charge(0) );
 
 #pragma omp simd
@@ -61,9 +71,9 @@ void PusherHigueraCary::operator() (Particles &particles, SmileiMPI* smpi, int i
         charge_over_mass_dts2 = (double)(charge[ipart])*one_over_mass_*dts2;
 
         // init Half-acceleration in the electric field
-        pxsm = charge_over_mass_dts2*(*Epart)[ipart].x;
-        pysm = charge_over_mass_dts2*(*Epart)[ipart].y;
-        pzsm = charge_over_mass_dts2*(*Epart)[ipart].z;
+        pxsm = charge_over_mass_dts2*Ex[ipart];
+        pysm = charge_over_mass_dts2*Ey[ipart];
+        pzsm = charge_over_mass_dts2*Ez[ipart];
 
         //(*this)(particles, ipart, (*Epart)[ipart], (*Bpart)[ipart] , (*invgf)[ipart]);
         umx = momentum[0][ipart] + pxsm;
@@ -72,19 +82,20 @@ void PusherHigueraCary::operator() (Particles &particles, SmileiMPI* smpi, int i
 
         // Intermediate gamma factor: only this part differs from the Boris scheme
         // Square Gamma factor from um
-        gfm2 = ( 1.0 + umx*umx + umy*umy + umz*umz );
+        gfm2 = ( one + umx*umx + umy*umy + umz*umz );
 
         // Equivalent of betax,betay,betaz in the paper
-        Tx    = charge_over_mass_dts2 * (*Bpart)[ipart].x;
-        Ty    = charge_over_mass_dts2 * (*Bpart)[ipart].y;
-        Tz    = charge_over_mass_dts2 * (*Bpart)[ipart].z;
+        Tx    = charge_over_mass_dts2 * Bx[ipart];
+        Ty    = charge_over_mass_dts2 * By[ipart];
+        Tz    = charge_over_mass_dts2 * Bz[ipart];
 
         // beta**2
         beta2 = Tx*Tx + Ty*Ty + Tz*Tz;        
 
         // Equivalent of 1/\gamma_{new} in the paper
-        local_invgf = 1./sqrt(0.5*(gfm2 - beta2 + 
-                    sqrt(pow(gfm2 - beta2,2) + 4.0*(beta2 + pow(Tx*umx + Ty*umy + Tz*umz,2) ))));
+        sigma = gfm2 - beta2;
+        uT    = Tx*umx + Ty*umy + Tz*umz;
+        local_invgf = one/sqrt(half*(sigma + sqrt(sigma*sigma + four*(beta2 + uT*uT))));
 
         // Rotation in the magnetic field
         Tx    *= local_invgf;
@@ -96,11 +107,11 @@ void PusherHigueraCary::operator() (Particles &particles, SmileiMPI* smpi, int i
         TxTy  = Tx*Ty;
         TyTz  = Ty*Tz;
         TzTx  = Tz*Tx;
-        inv_det_T = 1.0/(1.0+Tx2+Ty2+Tz2);
+        inv_det_T = one/(one+Tx2+Ty2+Tz2);
 
-        upx = (  (1.0+Tx2-Ty2-Tz2)* umx  +      2.0*(TxTy+Tz)* umy  +      2.0*(TzTx-Ty)* umz  )*inv_det_T;
-        upy = (      2.0*(TxTy-Tz)* umx  +  (1.0-Tx2+Ty2-Tz2)* umy  +      2.0*(TyTz+Tx)* umz  )*inv_det_T;
-        upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
+        upx = (  (one+Tx2-Ty2-Tz2)* umx  +      two*(TxTy+Tz)* umy  +      two*(TzTx-Ty)* umz  )*inv_det_T;
+        upy = (      two*(TxTy-Tz)* umx  +  (one-Tx2+Ty2-Tz2)* umy  +      two*(TyTz+Tx)* umz  )*inv_det_T;
+        upz = (      two*(TzTx+Ty)* umx  +      two*(TyTz-Tx)* umy  +  (one-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
 
         // finalize Half-acceleration in the electric field
         pxsm += upx;
@@ -108,19 +119,103 @@ void PusherHigueraCary::operator() (Particles &particles, SmileiMPI* smpi, int i
         pzsm += upz;
 
         // final gamma factor
-        (*invgf)[ipart] = 1. / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        local_invgf = one / sqrt( one + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        (*invgf)[ipart] = local_invgf;
 
         momentum[0][ipart] = pxsm;
         momentum[1][ipart] = pysm;
         momentum[2][ipart] = pzsm;
 
         // Move the particle
-#ifdef  __DEBUG
         for ( int i = 0 ; i<nDim_ ; i++ ) 
-            position_old[i][ipart] = position[i][ipart];
-#endif
+            position[i][ipart]     += dt*momentum[i][ipart]*local_invgf;
+
+    }
+}
+
+// Momentum stored in double, increment computed in float : as in PusherBoris::pushMixed, the half accelerations and
+// the rotation u+ - u- = 2 [ T(u-.T) - T^2 u- + u- x T ] / (1+T^2) are computed in float and accumulated in double
+void PusherHigueraCary::pushMixed(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    int nparts = smpi->dynamics_invgf[ithread].size();
+    double* Ex = smpi->dynamics_Epart[ithread].data();
+    double* Ey = Ex + nparts;
+    double* Ez = Ey + nparts;
+    double* Bx = smpi->dynamics_Bpart[ithread].data();
+    double* By = Bx + nparts;
+    double* Bz = By + nparts;
+    std::vector<double> *invgf = &(smpi->dynamics_invgf[ithread]);
+
+    const float one = 1.0f, two = 2.0f, four = 4.0f, half = 0.5f;
+    const float one_over_mass = one_over_mass_, dts2_f = dts2;
+
+    float charge_over_mass_dts2;
+    float umx, umy, umz, gfm2;
+    float beta2, Tx, Ty, Tz, T2, rot;
+    float pxsm, pysm, pzsm;
+    float local_invgf, sigma, uT;
+    double invgf_new;
+
+    double* momentum[3];
+    for ( int i = 0 ; i<3 ; i++ )
+        momentum[i] =  particles.Momentum[i].data<double>();
+    double* position[3];
+    for ( int i = 0 ; i<nDim_ ; i++ )
+        position[i] =  particles.Position[i].data<double>();
+    short* charge = &( particles.charge(0) );
+
+#pragma omp simd
+    for (int ipart=istart ; ipart<iend; ipart++ ) {
+        charge_over_mass_dts2 = (float)(charge[ipart])*one_over_mass*dts2_f;
+
+        // init Half-acceleration in the electric field
+        pxsm = charge_over_mass_dts2*(float)Ex[ipart];
+        pysm = charge_over_mass_dts2*(float)Ey[ipart];
+        pzsm = charge_over_mass_dts2*(float)Ez[ipart];
+
+        umx = (float)momentum[0][ipart] + pxsm;
+        umy = (float)momentum[1][ipart] + pysm;
+        umz = (float)momentum[2][ipart] + pzsm;
+
+        // Intermediate gamma factor: only this part differs from the Boris scheme
+        // Square Gamma factor from um
+        gfm2 = ( one + umx*umx + umy*umy + umz*umz );
+
+        // Equivalent of betax,betay,betaz in the paper
+        Tx    = charge_over_mass_dts2 * (float)Bx[ipart];
+        Ty    = charge_over_mass_dts2 * (float)By[ipart];
+        Tz    = charge_over_mass_dts2 * (float)Bz[ipart];
+
+        // beta**2
+        beta2 = Tx*Tx + Ty*Ty + Tz*Tz;        
+
+        // Equivalent of 1/\gamma_{new} in the paper
+        sigma = gfm2 - beta2;
+        uT    = Tx*umx + Ty*umy + Tz*umz;
+        local_invgf = one/sqrt(half*(sigma + sqrt(sigma*sigma + four*(beta2 + uT*uT))));
+
+        // Rotation in the magnetic field
+        Tx    *= local_invgf;
+        Ty    *= local_invgf;
+        Tz    *= local_invgf;
+        T2    = Tx*Tx + Ty*Ty + Tz*Tz;
+        uT    = Tx*umx + Ty*umy + Tz*umz;
+        rot   = two/(one+T2);
+
+        // Increment : both half accelerations and the rotation, accumulated in double
+        momentum[0][ipart] += (double)( two*pxsm + rot*( uT*Tx - T2*umx + umy*Tz - umz*Ty ) );
+        momentum[1][ipart] += (double)( two*pysm + rot*( uT*Ty - T2*umy + umz*Tx - umx*Tz ) );
+        momentum[2][ipart] += (double)( two*pzsm + rot*( uT*Tz - T2*umz + umx*Ty - umy*Tx ) );
+
+        // final gamma factor
+        invgf_new = 1. / sqrt( 1. + momentum[0][ipart]*momentum[0][ipart]
+                                   + momentum[1][ipart]*momentum[1][ipart]
+                                   + momentum[2][ipart]*momentum[2][ipart] );
+        (*invgf)[ipart] = invgf_new;
+
+        // Move the particle
         for ( int i = 0 ; i<nDim_ ; i++ ) 
-            position[i][ipart]     += dt*momentum[i][ipart]*(*invgf)[ipart];
+            position[i][ipart]     += dt*momentum[i][ipart]*invgf_new;
 
     }
 }
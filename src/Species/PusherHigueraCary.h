@@ -22,6 +22,11 @@ class PusherHigueraCary : public Pusher {
         ~PusherHigueraCary();
         //! Overloading of () operator
         virtual void operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
+    private:
+        //! Push in double precision
+        void push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
+        //! Push with the momentum increment computed in single precision (the momentum and positions stay in double)
+        void pushMixed(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
 };
 
 #endif
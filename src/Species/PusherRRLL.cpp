@@ -11,6 +11,11 @@ using namespace std;
 PusherRRLL::PusherRRLL(Params& params, Species *species)
     : Pusher(params, species)
 {
+    if (params.referenceAngularFrequency_SI<=0.)
+        ERROR("For species '" << species->species_type << "', the radiation reaction requires referenceAngularFrequency_SI");
+    
+    rr_coeff  = 6.266424e-24   * params.referenceAngularFrequency_SI; // 2 re omega / 3c
+    chi_coeff = 1.28808867e-21 * params.referenceAngularFrequency_SI; // hbar omega / (me c^2)
 }
 
 PusherRRLL::~PusherRRLL()
@@ -19,94 +24,53 @@ PusherRRLL::~PusherRRLL()
 
 /****************************************************************************
     Lorentz Force -- leap-frog (Boris) scheme + classical rad. reaction force
+    The Landau-Lifshitz friction (dominant term) is applied after the Boris step (first order splitting) :
+        du/dt = - rr_coeff q^4/m^3 gamma F^2 u,   with F^2 = (E + v x B)^2 - (v.E)^2
+    and the quantum parameter is chi = chi_coeff |q|/m^2 gamma |F|
 *****************************************************************************/
-void PusherRRLL::operator() (Particles &particles, int ipart, LocalFields Epart, LocalFields Bpart, double& invgf)
-{
-    // Declaration of local variables
-    // ------------------------------
-
-    double charge_over_mass_ = static_cast<double>(particles.charge(ipart))*one_over_mass_;
-    double umx, umy, umz, upx, upy, upz;
-    double alpha, inv_det_T, Tx, Ty, Tz, Tx2, Ty2, Tz2;
-    double TxTy, TyTz, TzTx;
-    double pxsm, pysm, pzsm;
-
-    //DEBUG(5, "\tPush particle"<< particles.position(0, ipart) );
-
-    // --------------------------------------
-    // SOLVE THE PARTICLE EQUATION OF MOTIONS
-    // --------------------------------------
-
-    // Half-acceleration in the electric field
-    umx = particles.momentum(0, ipart) + charge_over_mass_*Epart.x*dts2;
-    umy = particles.momentum(1, ipart) + charge_over_mass_*Epart.y*dts2;
-    umz = particles.momentum(2, ipart) + charge_over_mass_*Epart.z*dts2;
-    invgf  = 1. / sqrt( 1.0 + umx*umx + umy*umy + umz*umz );
-
-    // Rotation in the magnetic field
-    alpha = charge_over_mass_*dts2*invgf;
-    Tx    = alpha * Bpart.x;
-    Ty    = alpha * Bpart.y;
-    Tz    = alpha * Bpart.z;
-    Tx2   = Tx*Tx;
-    Ty2   = Ty*Ty;
-    Tz2   = Tz*Tz;
-    TxTy  = Tx*Ty;
-    TyTz  = Ty*Tz;
-    TzTx  = Tz*Tx;
-    inv_det_T = 1.0/(1.0+Tx2+Ty2+Tz2);
-
-    upx = (  (1.0+Tx2-Ty2-Tz2)* umx  +      2.0*(TxTy+Tz)* umy  +      2.0*(TzTx-Ty)* umz  )*inv_det_T;
-    upy = (      2.0*(TxTy-Tz)* umx  +  (1.0-Tx2+Ty2-Tz2)* umy  +      2.0*(TyTz+Tx)* umz  )*inv_det_T;
-    upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
-
-    // Half-acceleration in the electric field
-    pxsm = upx + charge_over_mass_*Epart.x*dts2;
-    pysm = upy + charge_over_mass_*Epart.y*dts2;
-    pzsm = upz + charge_over_mass_*Epart.z*dts2;
-    invgf = 1. / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
-
-    particles.momentum(0, ipart) = pxsm;
-    particles.momentum(1, ipart) = pysm;
-    particles.momentum(2, ipart) = pzsm;
-
-    // Move the particle
-    for ( int i = 0 ; i<nDim_ ; i++ ) {
-        //particles.position_old(i, ipart)  = particles.position(i, ipart);
-        particles.position(i, ipart)     += dt*particles.momentum(i, ipart)*invgf;
-    }
-
-    // COMPUTE Chi
-    particles.chi(ipart)=0.5;
-    //DEBUG(5, "\t END "<< particles.position(0, ipart) );
-
-}
 void PusherRRLL::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    int nparts = smpi->dynamics_invgf[ithread].size();
+    double* Ex = smpi->dynamics_Epart[ithread].data();
+    double* Ey = Ex + nparts;
+    double* Ez = Ey + nparts;
+    double* Bx = smpi->dynamics_Bpart[ithread].data();
+    double* By = Bx + nparts;
+    double* Bz = By + nparts;
     std::vector<double> *invgf = &(smpi->dynamics_invgf[ithread]);
-    double charge_over_mass_ ;
+    
+    double charge_over_mass_, charge2_over_mass2;
     double umx, umy, umz, upx, upy, upz;
     double alpha, inv_det_T, Tx, Ty, Tz, Tx2, Ty2, Tz2;
     double TxTy, TyTz, TzTx;
     double pxsm, pysm, pzsm;
-    double local_invgf;
-
+    double local_invgf, gamma, vx, vy, vz, Fx, Fy, Fz, vE, F2, friction;
+    
+    double* momentum[3];
+    for ( int i = 0 ; i<3 ; i++ )
+        momentum[i] =  particles.Momentum[i].data<double>();
+    double* position[3];
+    for ( int i = 0 ; i<nDim_ ; i++ )
+        position[i] =  particles.Position[i].data<double>();
+    short* charge = &( particles.charge(0) );
+    double* chi = particles.Chi.data();
+    
+    #pragma omp simd
     for (int ipart=istart ; ipart<iend; ipart++ ) {
-        //(*this)(particles, iPart, (*Epart)[iPart], (*Bpart)[iPart] , (*invgf)[iPart]);
-        charge_over_mass_ = static_cast<double>(particles.charge(ipart))*one_over_mass_;
+        charge_over_mass_ = (double)(charge[ipart])*one_over_mass_;
+        charge2_over_mass2 = charge_over_mass_*charge_over_mass_;
+        
         // Half-acceleration in the electric field
-        umx = particles.momentum(0, ipart) + charge_over_mass_*(*Epart)[ipart].x*dts2;
-        umy = particles.momentum(1, ipart) + charge_over_mass_*(*Epart)[ipart].y*dts2;
-        umz = particles.momentum(2, ipart) + charge_over_mass_*(*Epart)[ipart].z*dts2;
+        umx = momentum[0][ipart] + charge_over_mass_*Ex[ipart]*dts2;
+        umy = momentum[1][ipart] + charge_over_mass_*Ey[ipart]*dts2;
+        umz = momentum[2][ipart] + charge_over_mass_*Ez[ipart]*dts2;
         local_invgf  = 1. / sqrt( 1.0 + umx*umx + umy*umy + umz*umz );
-
+        
         // Rotation in the magnetic field
         alpha = charge_over_mass_*dts2*local_invgf;
-        Tx    = alpha * (*Bpart)[ipart].x;
-        Ty    = alpha * (*Bpart)[ipart].y;
-        Tz    = alpha * (*Bpart)[ipart].z;
+        Tx    = alpha * Bx[ipart];
+        Ty    = alpha * By[ipart];
+        Tz    = alpha * Bz[ipart];
         Tx2   = Tx*Tx;
         Ty2   = Ty*Ty;
         Tz2   = Tz*Tz;
@@ -114,27 +78,46 @@ void PusherRRLL::operator() (Particles &particles, SmileiMPI* smpi, int istart,
         TyTz  = Ty*Tz;
         TzTx  = Tz*Tx;
         inv_det_T = 1.0/(1.0+Tx2+Ty2+Tz2);
-
+        
         upx = (  (1.0+Tx2-Ty2-Tz2)* umx  +      2.0*(TxTy+Tz)* umy  +      2.0*(TzTx-Ty)* umz  )*inv_det_T;
         upy = (      2.0*(TxTy-Tz)* umx  +  (1.0-Tx2+Ty2-Tz2)* umy  +      2.0*(TyTz+Tx)* umz  )*inv_det_T;
         upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
-
+        
         // Half-acceleration in the electric field
-        pxsm = upx + charge_over_mass_*(*Epart)[ipart].x*dts2;
-        pysm = upy + charge_over_mass_*(*Epart)[ipart].y*dts2;
-        pzsm = upz + charge_over_mass_*(*Epart)[ipart].z*dts2;
-        (*invgf)[ipart] = 1. / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
-
-        particles.momentum(0, ipart) = pxsm;
-        particles.momentum(1, ipart) = pysm;
-        particles.momentum(2, ipart) = pzsm;
-
+        pxsm = upx + charge_over_mass_*Ex[ipart]*dts2;
+        pysm = upy + charge_over_mass_*Ey[ipart]*dts2;
+        pzsm = upz + charge_over_mass_*Ez[ipart]*dts2;
+        gamma = sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        
+        // Lorentz force transverse to the velocity (F^2 = (E + v x B)^2 - (v.E)^2)
+        vx = pxsm/gamma;
+        vy = pysm/gamma;
+        vz = pzsm/gamma;
+        Fx = Ex[ipart] + vy*Bz[ipart] - vz*By[ipart];
+        Fy = Ey[ipart] + vz*Bx[ipart] - vx*Bz[ipart];
+        Fz = Ez[ipart] + vx*By[ipart] - vy*Bx[ipart];
+        vE = vx*Ex[ipart] + vy*Ey[ipart] + vz*Ez[ipart];
+        F2 = Fx*Fx + Fy*Fy + Fz*Fz - vE*vE;
+        F2 = F2 > 0. ? F2 : 0.;
+        
+        // Quantum parameter
+        chi[ipart] = chi_coeff * fabs(charge_over_mass_) * one_over_mass_ * gamma * sqrt(F2);
+        
+        // Radiation friction (Landau-Lifshitz)
+        friction = 1. - dt * rr_coeff * charge2_over_mass2 * charge2_over_mass2 * mass_ * gamma * F2;
+        friction = friction > 0. ? friction : 0.;
+        pxsm *= friction;
+        pysm *= friction;
+        pzsm *= friction;
+        local_invgf = 1. / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        (*invgf)[ipart] = local_invgf;
+        
+        momentum[0][ipart] = pxsm;
+        momentum[1][ipart] = pysm;
+        momentum[2][ipart] = pzsm;
+        
         // Move the particle
         for ( int i = 0 ; i<nDim_ ; i++ )
-            particles.position(i, ipart)     += dt*particles.momentum(i, ipart)*(*invgf)[ipart];
-
-        // COMPUTE Chi
-        particles.chi(ipart)=0.5;
-        //DEBUG(5, "\t END "<< particles.position(0, ipart) );
+            position[i][ipart]     += dt*momentum[i][ipart]*local_invgf;
     }
 }
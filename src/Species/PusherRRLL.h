@@ -19,9 +19,14 @@ public:
     PusherRRLL(Params& params, Species*);
     ~PusherRRLL();
     //! Overloading of () operator
-    virtual void operator() (Particles &particles, int ipart, LocalFields Epart, LocalFields Bpart, double& invgf);
     virtual void operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
 
+private:
+    //! Landau-Lifshitz friction coefficient 2 re omega / 3c, for electrons in normalized units
+    double rr_coeff;
+    //! Quantum parameter coefficient hbar omega / (me c^2)
+    double chi_coeff;
+
 };
 
 #endif
@@ -33,30 +33,41 @@ PusherVay::~PusherVay()
 
 void PusherVay::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    if (singleArithmetic)
+        pushMixed(particles, smpi, istart, iend, ithread);
+    else
+        push(particles, smpi, istart, iend, ithread);
+}
+
+void PusherVay::push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    int nparts = smpi->dynamics_invgf[ithread].size();
+    double* Ex = smpi->dynamics_Epart[ithread].data();
+    double* Ey = Ex + nparts;
+    double* Ez = Ey + nparts;
+    double* Bx = smpi->dynamics_Bpart[ithread].data();
+    double* By = Bx + nparts;
+    double* Bz = By + nparts;
     std::vector<double> *invgf = &(smpi->dynamics_invgf[ithread]);
 
+    const double one = 1.0, two = 2.0, four = 4.0, half = 0.5;
+
     double charge_over_mass_dts2;
     double upx, upy, upz, us2;
     double alpha, s, T2 ;
     double Tx, Ty, Tz;
     double pxsm, pysm, pzsm;
+    double pxm, pym, pzm, local_invgf;
     // Only useful for the second method
     //double Tx2, Ty2, Tz2;
     //double TxTy, TyTz, TzTx;
 
     double* momentum[3];
     for ( int i = 0 ; i<3 ; i++ )
-        momentum[i] =  &( particles.momentum(i,0) );
+        momentum[i] =  particles.Momentum[i].data<double>();
     double* position[3];
     for ( int i = 0 ; i<nDim_ ; i++ )
-        position[i] =  &( particles.position(i,0) );
-#ifdef  __DEBUG
-    double* position_old[3];
-    for ( int i = 0 ; i<nDim_ ; i++ )
-        position_old[i] =  &( particles.position_old(i,0) );
-#endif
+        position[i] =  particles.Position[i].data<double>();
     short* charge = &( particles.charge(0) );
 
     #pragma omp simd
@@ -66,27 +77,29 @@ void PusherVay::operator() (Particles &particles, SmileiMPI* smpi, int istart, i
         // ____________________________________________
         // Part I: Computation of uprime
 
+        pxm = momentum[0][ipart];
+        pym = momentum[1][ipart];
+        pzm = momentum[2][ipart];
+
         // For unknown reason, this has to be computed again
-        (*invgf)[ipart] = 1./sqrt(1.0 + momentum[0][ipart]*momentum[0][ipart] 
-                              + momentum[1][ipart]*momentum[1][ipart] 
-                              + momentum[2][ipart]*momentum[2][ipart]);
+        local_invgf = one/sqrt(one + pxm*pxm + pym*pym + pzm*pzm);
 
         // Add Electric field
-        upx = momentum[0][ipart] + 2.*charge_over_mass_dts2*(*Epart)[ipart].x;
-        upy = momentum[1][ipart] + 2.*charge_over_mass_dts2*(*Epart)[ipart].y;
-        upz = momentum[2][ipart] + 2.*charge_over_mass_dts2*(*Epart)[ipart].z;
+        upx = pxm + two*charge_over_mass_dts2*Ex[ipart];
+        upy = pym + two*charge_over_mass_dts2*Ey[ipart];
+        upz = pzm + two*charge_over_mass_dts2*Ez[ipart];
 
         // Add magnetic field
-        Tx  = charge_over_mass_dts2* (*Bpart)[ipart].x;
-        Ty  = charge_over_mass_dts2* (*Bpart)[ipart].y;
-        Tz  = charge_over_mass_dts2* (*Bpart)[ipart].z;
+        Tx  = charge_over_mass_dts2* Bx[ipart];
+        Ty  = charge_over_mass_dts2* By[ipart];
+        Tz  = charge_over_mass_dts2* Bz[ipart];
 
-        upx += (*invgf)[ipart]*(momentum[1][ipart]*Tz - momentum[2][ipart]*Ty); 
-        upy += (*invgf)[ipart]*(momentum[2][ipart]*Tx - momentum[0][ipart]*Tz);
-        upz += (*invgf)[ipart]*(momentum[0][ipart]*Ty - momentum[1][ipart]*Tx);
+        upx += local_invgf*(pym*Tz - pzm*Ty); 
+        upy += local_invgf*(pzm*Tx - pxm*Tz);
+        upz += local_invgf*(pxm*Ty - pym*Tx);
 
         // alpha is gamma^2
-        alpha = 1.0 + upx*upx + upy*upy + upz*upz;
+        alpha = one + upx*upx + upy*upy + upz*upz;
         T2    = Tx*Tx + Ty*Ty + Tz*Tz;
 
         // ___________________________________________
@@ -94,16 +107,17 @@ void PusherVay::operator() (Particles &particles, SmileiMPI* smpi, int istart, i
 
         // s is sigma
         s     = alpha - T2; 
-        us2   = pow(upx*Tx + upy*Ty + upz*Tz,2.0);
+        us2   = upx*Tx + upy*Ty + upz*Tz;
+        us2  *= us2;
 
         // alpha becomes 1/gamma^{i+1}
-        alpha = 1.0/sqrt(0.5*(s + sqrt(s*s + 4.0*( T2 + us2 ))));
+        alpha = one/sqrt(half*(s + sqrt(s*s + four*( T2 + us2 ))));
 
         Tx *= alpha;
         Ty *= alpha;
         Tz *= alpha;
 
-        s = 1.0/(1.0+Tx*Tx+Ty*Ty+Tz*Tz);
+        s = one/(one+Tx*Tx+Ty*Ty+Tz*Tz);
         alpha   = upx*Tx + upy*Ty + upz*Tz;
         
         pxsm = s*(upx + alpha*Tx + Tz*upy - Ty*upz);
@@ -124,19 +138,116 @@ void PusherVay::operator() (Particles &particles, SmileiMPI* smpi, int istart, i
         //pzsm = ((TzTx+Ty)* upx  + (TyTz-Tx)* upy + (1.0+Tz2)* upz)*s;
 
         // Inverse Gamma factor
-        (*invgf)[ipart] = 1.0 / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        local_invgf = one / sqrt( one + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        (*invgf)[ipart] = local_invgf;
 
         momentum[0][ipart] = pxsm;
         momentum[1][ipart] = pysm;
         momentum[2][ipart] = pzsm;
 
         // Move the particle
-#ifdef  __DEBUG
         for ( int i = 0 ; i<nDim_ ; i++ ) 
-          position_old[i][ipart] = position[i][ipart];
-#endif
+            position[i][ipart]     += dt*momentum[i][ipart]*local_invgf;
+
+    }
+}
+
+// Momentum stored in double, increment computed in float : with delta = 2 q/m dt/2 E + (p x T)/gamma and u' = p + delta,
+// p_new - p = s [ delta + (u'.t) t + u' x t - t^2 p ] only involves small terms, whose float round-off is relative
+// to the increment and not to the momentum, which is accumulated in double
+void PusherVay::pushMixed(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+{
+    int nparts = smpi->dynamics_invgf[ithread].size();
+    double* Ex = smpi->dynamics_Epart[ithread].data();
+    double* Ey = Ex + nparts;
+    double* Ez = Ey + nparts;
+    double* Bx = smpi->dynamics_Bpart[ithread].data();
+    double* By = Bx + nparts;
+    double* Bz = By + nparts;
+    std::vector<double> *invgf = &(smpi->dynamics_invgf[ithread]);
+
+    const float one = 1.0f, two = 2.0f, four = 4.0f, half = 0.5f;
+    const float one_over_mass = one_over_mass_, dts2_f = dts2;
+
+    float charge_over_mass_dts2;
+    float dpx, dpy, dpz, upx, upy, upz, us2;
+    float alpha, s, T2 ;
+    float Tx, Ty, Tz;
+    float pxm, pym, pzm, local_invgf;
+    double invgf_new;
+
+    double* momentum[3];
+    for ( int i = 0 ; i<3 ; i++ )
+        momentum[i] =  particles.Momentum[i].data<double>();
+    double* position[3];
+    for ( int i = 0 ; i<nDim_ ; i++ )
+        position[i] =  particles.Position[i].data<double>();
+    short* charge = &( particles.charge(0) );
+
+    #pragma omp simd
+    for (int ipart=istart ; ipart<iend; ipart++ ) {
+        charge_over_mass_dts2 = (float)(charge[ipart])*one_over_mass*dts2_f;
+
+        // ____________________________________________
+        // Part I: Computation of uprime = p + delta
+
+        pxm = (float)momentum[0][ipart];
+        pym = (float)momentum[1][ipart];
+        pzm = (float)momentum[2][ipart];
+
+        local_invgf = one/sqrt(one + pxm*pxm + pym*pym + pzm*pzm);
+
+        // Magnetic field
+        Tx  = charge_over_mass_dts2* (float)Bx[ipart];
+        Ty  = charge_over_mass_dts2* (float)By[ipart];
+        Tz  = charge_over_mass_dts2* (float)Bz[ipart];
+
+        // delta
+        dpx = two*charge_over_mass_dts2*(float)Ex[ipart] + local_invgf*(pym*Tz - pzm*Ty);
+        dpy = two*charge_over_mass_dts2*(float)Ey[ipart] + local_invgf*(pzm*Tx - pxm*Tz);
+        dpz = two*charge_over_mass_dts2*(float)Ez[ipart] + local_invgf*(pxm*Ty - pym*Tx);
+
+        upx = pxm + dpx;
+        upy = pym + dpy;
+        upz = pzm + dpz;
+
+        // alpha is gamma^2
+        alpha = one + upx*upx + upy*upy + upz*upz;
+        T2    = Tx*Tx + Ty*Ty + Tz*Tz;
+
+        // ___________________________________________
+        // Part II: Computation of Gamma^{i+1}
+
+        // s is sigma
+        s     = alpha - T2; 
+        us2   = upx*Tx + upy*Ty + upz*Tz;
+        us2  *= us2;
+
+        // alpha becomes 1/gamma^{i+1}
+        alpha = one/sqrt(half*(s + sqrt(s*s + four*( T2 + us2 ))));
+
+        Tx *= alpha;
+        Ty *= alpha;
+        Tz *= alpha;
+
+        T2 = Tx*Tx+Ty*Ty+Tz*Tz;
+        s = one/(one+T2);
+        alpha   = upx*Tx + upy*Ty + upz*Tz;
+
+        // Increment, accumulated in double
+        momentum[0][ipart] += (double)( s*(dpx + alpha*Tx + Tz*upy - Ty*upz - T2*pxm) );
+        momentum[1][ipart] += (double)( s*(dpy + alpha*Ty + Tx*upz - Tz*upx - T2*pym) );
+        momentum[2][ipart] += (double)( s*(dpz + alpha*Tz + Ty*upx - Tx*upy - T2*pzm) );
+
+        // Inverse Gamma factor
+        invgf_new = 1. / sqrt( 1. + momentum[0][ipart]*momentum[0][ipart]
+                                   + momentum[1][ipart]*momentum[1][ipart]
+                                   + momentum[2][ipart]*momentum[2][ipart] );
+        (*invgf)[ipart] = invgf_new;
+
+        // Move the particle
         for ( int i = 0 ; i<nDim_ ; i++ ) 
-            position[i][ipart]     += dt*momentum[i][ipart]*(*invgf)[ipart];
+            position[i][ipart]     += dt*momentum[i][ipart]*invgf_new;
 
     }
 }
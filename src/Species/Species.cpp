@@ -3,6 +3,7 @@
 #include <cmath>
 #include <ctime>
 #include <cstdlib>
+#include <algorithm>
 
 #include <iostream>
 
@@ -13,6 +14,8 @@
 // IDRIS
 #include "PusherFactory.h"
 #include "IonizationFactory.h"
+#include "MergingFactory.h"
+#include "Resampling.h"
 #include "PartBoundCond.h"
 #include "PartWall.h"
 #include "BoundaryConditionType.h"
@@ -48,11 +51,23 @@ dynamics_type("norm"),
 time_frozen(0), 
 radiating(false), 
 ionization_model("none"),
+merging_method("none"),
+merge_every(0),
+merge_min_particles_per_cell(4),
+merge_momentum_cells(3,4),
+resampling_every(0),
+resampling_ceiling(2.),
+sort_mode("bin"),
+sort_threshold(0.),
+subcycle(1),
+push_precision("double"),
 velocityProfile(3,NULL),
 temperatureProfile(3,NULL),
+resamplingProfile(NULL),
 particles(&particles_sorted[0]),
 electron_species(NULL),
 clrw(params.clrw),  
+chunk_size(params.chunk_size),
 oversize(params.oversize), 
 cell_length(params.cell_length), 
 min_loc_vec(patch->getDomainLocalMin()), 
@@ -73,6 +88,14 @@ min_loc(patch->getDomainLocalMin(0))
     initCluster(params);
     nDim_field = params.nDim_field;
     inv_nDim_field = 1./((double)nDim_field);
+    
+    // The per-particle boundary conditions are compiled for the dimension of the particles
+    if (nDim_particle==1)
+        boundaryConditions = &Species::applyBoundaryConditions<1>;
+    else if (nDim_particle==2)
+        boundaryConditions = &Species::applyBoundaryConditions<2>;
+    else
+        boundaryConditions = &Species::applyBoundaryConditions<3>;
 
 }//END Species creator
 
@@ -134,6 +157,12 @@ void Species::initOperators(Params& params, Patch* patch)
         DEBUG("Species " << species_type << " can be ionized!");
     }
     
+    // Assign the Merging method (if needed) to Merge
+    Merge = MergingFactory::create(params, this);
+    
+    // Assign the Resampling (if needed) to Resample
+    Resample = resamplingProfile ? new Resampling(params, this, patch) : NULL;
+    
     // define limits for BC and functions applied and for domain decomposition
     partBoundCond = new PartBoundCond(params, this, patch);
     
@@ -159,8 +188,11 @@ Species::~Species()
 {
     delete Push;
     if (Ionize) delete Ionize;
+    if (Merge) delete Merge;
+    if (Resample) delete Resample;
     if (partBoundCond) delete partBoundCond;
     if (ppcProfile) delete ppcProfile;
+    if (resamplingProfile) delete resamplingProfile;
     if (chargeProfile) delete chargeProfile;
     if (densityProfile) delete densityProfile;
     for (unsigned int i=0; i<velocityProfile.size(); i++)
@@ -421,7 +453,7 @@ void Species::initMomentum(unsigned int nPart, unsigned int iPart, double *temp,
 //   - apply the boundary conditions
 //   - increment the currents (projection)
 // ---------------------------------------------------------------------------------------------------------------------
-void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfields, Interpolator* Interp,
+void Species::dynamics(double time_dual, int itime, unsigned int ispec, ElectroMagn* EMfields, Interpolator* Interp,
                        Projector* Proj, Params &params, bool diag_flag, PartWalls* partWalls, Patch* patch, SmileiMPI* smpi, vector<Diagnostic*>& localDiags)
 {
     int ithread;
@@ -440,55 +472,64 @@ void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfiel
     double ener_iPart(0.);
     std::vector<double> nrj_lost_per_thd(1, 0.);
     
+    // A subcycled species only moves at the timesteps multiple of subcycle, by subcycle*dt (the pusher timestep).
+    // The whole displacement is projected at once : the current is zero in between, as the charge does not change,
+    // so that the Esirkepov projection conserves the charge at every timestep. This is a first-order approximation :
+    // the move only uses the fields of the move timestep, instead of their average over the subcycle timesteps.
+    bool move_now = subcycle==1 || itime % subcycle == 0;
+    
     // -------------------------------
     // calculate the particle dynamics
     // -------------------------------
-    if (time_dual>time_frozen) { // moving particle
+    if (time_dual>time_frozen && move_now) { // moving particle
         
         smpi->dynamics_resize(ithread, nDim_particle, bmax.back());
         
         //Point to local thread dedicated buffers
         //Still needed for ionization
-        vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
+        vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
         
         for (unsigned int ibin = 0 ; ibin < bmin.size() ; ibin++) {
             
-            // Interpolate the fields at the particle position
-            (*Interp)(EMfields, *particles, smpi, bmin[ibin], bmax[ibin], ithread );
-            
-            //Ionization
-            if (Ionize)
-                (*Ionize)(particles, bmin[ibin], bmax[ibin], Epart, EMfields, Proj);
-            
-            // Push the particles
-            (*Push)(*particles, smpi, bmin[ibin], bmax[ibin], ithread );
-            //particles->test_move( bmin[ibin], bmax[ibin], params );
-            
-            // Apply wall and boundary conditions
-            for(unsigned int iwall=0; iwall<partWalls->size(); iwall++) {
-                for (iPart=bmin[ibin] ; (int)iPart<bmax[ibin]; iPart++ ) {
-                    double dtgf = params.timestep * smpi->dynamics_invgf[ithread][iPart];
-                    if ( !(*partWalls)[iwall]->apply(*particles, iPart, this, dtgf, ener_iPart)) {
-                        nrj_lost_per_thd[tid] += mass * ener_iPart;
+            // The bin is processed by chunks of particles which go through the whole dynamics
+            // while they and their buffers (Epart, Bpart, invgf, iold, deltaold) are still in the cache
+            int chunk = chunk_size>0 ? (int)chunk_size : max( bmax[ibin]-bmin[ibin], 1 );
+            for (int istart = bmin[ibin] ; istart < bmax[ibin] ; istart += chunk ) {
+                int iend = min( istart+chunk, bmax[ibin] );
+                
+                // Interpolate the fields at the particle position
+                (*Interp)(EMfields, *particles, smpi, istart, iend, ithread );
+                
+                //Ionization
+                if (Ionize)
+                    (*Ionize)(particles, istart, iend, Epart, EMfields, Proj);
+                
+                // Push the particles
+                (*Push)(*particles, smpi, istart, iend, ithread );
+                //particles->test_move( istart, iend, params );
+                
+                // Apply wall and boundary conditions, only if the chunk may reach a wall or the edges of the patch
+                // (the particles move by less than c*dt per timestep, most chunks are far from them)
+                double lo[3], hi[3];
+                chunkExtent( ibin, istart, iend, params.timestep * subcycle, lo, hi );
+                for(unsigned int iwall=0; iwall<partWalls->size(); iwall++) {
+                    if ( !(*partWalls)[iwall]->mayCross( lo, hi ) ) continue;
+                    for (iPart=istart ; (int)iPart<iend; iPart++ ) {
+                        double dtgf = params.timestep * subcycle * smpi->dynamics_invgf[ithread][iPart];
+                        if ( !(*partWalls)[iwall]->apply(*particles, iPart, this, dtgf, ener_iPart)) {
+                            nrj_lost_per_thd[tid] += mass * ener_iPart;
+                        }
                     }
                 }
-            }
-            // Boundary Condition may be physical or due to domain decomposition
-            // apply returns 0 if iPart is not in the local domain anymore
-            //        if omp, create a list per thread
-            for (iPart=bmin[ibin] ; (int)iPart<bmax[ibin]; iPart++ ) {
-                if ( !partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
-                    addPartInExchList( iPart );
-                    //nrj_lost_per_thd[tid] += ener_iPart;
-                    nrj_lost_per_thd[tid] += mass * ener_iPart;
-                }
-             }
-            
-            //START EXCHANGE PARTICLES OF THE CURRENT BIN ?
-            
-             // Project currents if not a Test species and charges as well if a diag is needed. 
-             if (!particles->isTest)
-                 (*Proj)(EMfields, *particles, smpi, bmin[ibin], bmax[ibin], ithread, ibin, clrw, diag_flag, b_dim, ispec );
+                // Boundary Condition may be physical or due to domain decomposition
+                if ( !partBoundCond->isInside( lo, hi ) )
+                    (this->*boundaryConditions)( istart, iend, nrj_lost_per_thd[tid] );
+                
+                // Project currents if not a Test species and charges as well if a diag is needed. 
+                if (!particles->isTest)
+                    (*Proj)(EMfields, *particles, smpi, istart, iend, ithread, ibin, clrw, diag_flag, b_dim, ispec );
+                
+            }// chunk
             
         }// ibin
         
@@ -499,17 +540,17 @@ void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfiel
         if (Ionize)
             electron_species->importParticles( params, patch, Ionize->new_electrons, localDiags );
     }
-    else { // immobile particle (at the moment only project density)
+    else { // immobile particle, or subcycled species in between two moves (at the moment only project density)
         if ( diag_flag &&(!particles->isTest)){
             double* b_rho=nullptr;
             for (unsigned int ibin = 0 ; ibin < bmin.size() ; ibin ++) { //Loop for projection on buffer_proj
                 
                 if (nDim_field==2)
-                    b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(ibin*clrw*f_dim1) : &(*EMfields->rho_)(ibin*clrw*f_dim1) ;
+                    b_rho = EMfields->rho_s_now[ispec] ? &(*EMfields->rho_s_now[ispec])(ibin*clrw*f_dim1) : &(*EMfields->rho_)(ibin*clrw*f_dim1) ;
                 if (nDim_field==3)
-                    b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(ibin*clrw*f_dim1*f_dim2) : &(*EMfields->rho_)(ibin*clrw*f_dim1*f_dim2) ;
+                    b_rho = EMfields->rho_s_now[ispec] ? &(*EMfields->rho_s_now[ispec])(ibin*clrw*f_dim1*f_dim2) : &(*EMfields->rho_)(ibin*clrw*f_dim1*f_dim2) ;
                 else if (nDim_field==1)
-                    b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(ibin*clrw) : &(*EMfields->rho_)(ibin*clrw) ;
+                    b_rho = EMfields->rho_s_now[ispec] ? &(*EMfields->rho_s_now[ispec])(ibin*clrw) : &(*EMfields->rho_)(ibin*clrw) ;
                 for (iPart=bmin[ibin] ; (int)iPart<bmax[ibin]; iPart++ ) {
                     (*Proj)(b_rho, (*particles), iPart, ibin*clrw, b_dim);
                 } //End loop on particles
@@ -550,12 +591,137 @@ void Species::computeCharge(unsigned int ispec, ElectroMagn* EMfields, Projector
 }//END computeCharge
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Apply the boundary conditions to the particles istart to iend-1
+//   - PartBoundCond::apply returns 0 if iPart is not in the local domain anymore
+//   - if omp, create a list per thread
+// ---------------------------------------------------------------------------------------------------------------------
+template<int nDim>
+void Species::applyBoundaryConditions(int istart, int iend, double &nrj_lost)
+{
+    double ener_iPart(0.);
+    for (int iPart=istart ; iPart<iend; iPart++ ) {
+        if ( !partBoundCond->apply<nDim>( *particles, iPart, this, ener_iPart ) ) {
+            addPartInExchList( iPart );
+            nrj_lost += mass * ener_iPart;
+        }
+    }
+    
+}//END applyBoundaryConditions
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Range [lo,hi] of the coordinates x[istart] to x[iend-1]
+// ---------------------------------------------------------------------------------------------------------------------
+static void positionRange(const double *x, int istart, int iend, double &lo, double &hi)
+{
+    double xmin = x[istart], xmax = x[istart];
+    #pragma omp simd reduction(min:xmin) reduction(max:xmax)
+    for (int iPart=istart ; iPart<iend; iPart++ ) {
+        xmin = min( xmin, x[iPart] );
+        xmax = max( xmax, x[iPart] );
+    }
+    lo = xmin;
+    hi = xmax;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Extent of the particles istart to iend-1 of bin ibin during a push of maximum displacement
+//   - along x, the bins are sorted : the particles started in the slab of bin ibin
+//   - along y and z, the bins span the whole patch : range of the pushed particles
+// The extent is widened by the displacement so that it contains the positions before and after the push
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::chunkExtent(unsigned int ibin, int istart, int iend, double displacement, double *lo, double *hi)
+{
+    lo[0] = min_loc +  ibin   *clrw*cell_length[0];
+    hi[0] = min_loc + (ibin+1)*clrw*cell_length[0];
+    for (unsigned int idim=1 ; idim<nDim_particle ; idim++) {
+        positionRange( particles->Position[idim].data<double>(), istart, iend, lo[idim], hi[idim] );
+    }
+    for (unsigned int idim=0 ; idim<nDim_particle ; idim++) {
+        lo[idim] -= displacement;
+        hi[idim] += displacement;
+    }
+    
+}//END chunkExtent
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Merge particles (bins must be sorted)
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::mergeParticles(int itime)
+{
+    if ( !Merge || itime==0 || itime%Merge->merge_every!=0 ) return;
+    
+    vector<int> remove_list;
+    for (unsigned int ibin=0 ; ibin<bmin.size() ; ibin++) {
+        remove_list.clear();
+        (*Merge)(particles, bmin[ibin], bmax[ibin], remove_list);
+        removeParticlesFromBin(ibin, remove_list);
+    }
+    packBins();
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Split and merge particles towards the target number of particles per cell (bins must be sorted)
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::resampleParticles(int itime, Params& params, Patch* patch, vector<Diagnostic*>& localDiags)
+{
+    if ( !Resample || itime==0 || itime%Resample->resampling_every!=0 ) return;
+    
+    vector<int> remove_list;
+    for (unsigned int ibin=0 ; ibin<bmin.size() ; ibin++) {
+        remove_list.clear();
+        (*Resample)(particles, bmin[ibin], bmax[ibin], remove_list);
+        removeParticlesFromBin(ibin, remove_list);
+    }
+    packBins();
+    
+    importParticles(params, patch, Resample->new_particles, localDiags);
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Remove a list of particles from one bin
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::removeParticlesFromBin(unsigned int ibin, vector<int>& remove_list)
+{
+    // Fill the holes with the last particles of the bin
+    sort( remove_list.begin(), remove_list.end() );
+    for (int i=remove_list.size()-1 ; i>=0 ; i--) {
+        if (remove_list[i] < bmax[ibin]-1)
+            particles->overwrite_part( bmax[ibin]-1, remove_list[i] );
+        bmax[ibin]--;
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Remove the gaps left between the bins by removeParticlesFromBin
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::packBins()
+{
+    //Shift the bins in memory
+    //Warning: this loop must be executed sequentially. Do not use openMP here.
+    for (unsigned int ibin=1 ; ibin<bmax.size() ; ibin++) {
+        int ii = bmin[ibin]-bmax[ibin-1]; // Shift the bin in memory by ii slots.
+        int n_move = min(ii,bmax[ibin]-bmin[ibin]); // Number of particles we have to shift
+        if (n_move > 0) particles->overwrite_part(bmax[ibin]-n_move,bmax[ibin-1],n_move);
+        bmax[ibin] -= ii;
+        bmin[ibin] = bmax[ibin-1];
+    }
+    particles->erase_particle_trail(bmax.back());
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Sort particles
 // ---------------------------------------------------------------------------------------------------------------------
 void Species::sort_part()
 {
     //The width of one bin is cell_length[0] * clrw.
+    const double* x = particles->Position[0].data<double>();
     
     int p1,p2,bmin_init;
     unsigned int bin;
@@ -568,14 +734,14 @@ void Species::sort_part()
         p1 = bmax[bin]-1;
         //If first particles change bin, they do not need to be swapped.
         while (p1 == bmax[bin]-1 && p1 >= bmin[bin]) {
-            if (particles->position(0,p1) >= limit ) {
+            if (x[p1] >= limit ) {
                 bmax[bin]--;
             }
             p1--;
         }
         //         Now particles have to be swapped
         for( p2 = p1 ; p2 >= bmin[bin] ; p2-- ) { //Loop on the bin's particles.
-            if (particles->position(0,p2) >= limit ) {
+            if (x[p2] >= limit ) {
                 //This particle goes up one bin.
                 particles->swap_part(p2,bmax[bin]-1);
                 bmax[bin]--;
@@ -588,13 +754,13 @@ void Species::sort_part()
         bmin_init = bmin[bin];
         p1 = bmin[bin];
         while (p1 == bmin[bin] && p1 < bmax[bin]) {
-            if (particles->position(0,p1) < limit ) {
+            if (x[p1] < limit ) {
                 bmin[bin]++;
             }
             p1++;
         }
         for( p2 = p1 ; p2 < bmax[bin] ; p2++ ) { //Loop on the bin's particles.
-            if (particles->position(0,p2) < limit ) {
+            if (x[p2] < limit ) {
                 //This particle goes down one bin.
                 particles->swap_part(p2,bmin[bin]);
                 bmin[bin]++;
@@ -613,74 +779,124 @@ void Species::sort_part()
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Sort particles
+// Sort particles by cell (sort_mode="cell" or "morton") : out-of-place counting sort into the other particles_sorted buffer
+// Each bin is made of consecutive cells. Within a bin, cells are numbered with z varying fastest, then y, then x
+// (sort_mode="cell"), or along a Z-order curve (sort_mode="morton", see sort_cell_rank)
+// The sort is skipped (returns false) while the fraction of particles found before a particle of a lower cell,
+// i.e. which left their cell since the last sort, remains below sort_threshold
 // ---------------------------------------------------------------------------------------------------------------------
-void Species::count_sort_part(Params &params)
+bool Species::count_sort_part(Params &params)
 {
-    unsigned int ip, npart, ixy,tot, oc, nxy, token;
-    int ix,iy;
-    double x,y;
-
-    nxy = params.n_space[0]*params.n_space[1];
+    unsigned int ip, icell, ndisorder, npart, token;
+    
+    unsigned int nx = params.n_space[0];
+    unsigned int ny = (nDim_particle>1) ? params.n_space[1] : 1;
+    unsigned int nz = (nDim_particle>2) ? params.n_space[2] : 1;
+    unsigned int ncells = nx*ny*nz;
+    unsigned int ncells_bin = clrw*ny*nz;
+    bool morton = (sort_mode=="morton");
+    if ( morton && sort_cell_rank.size()!=ncells_bin )
+        computeMortonRank(clrw, ny, nz);
+    
     token = (particles == &particles_sorted[0]);
-
-    int indices[nxy];
     npart = particles->size();
-    //particles_sorted = particles ;
-    particles_sorted[token].initialize(npart, *particles);
-
-    for (unsigned int i=0; i < nxy ; i++) indices[i] = 0 ;
-
-    // first loop counts the # of particles in each cell
+    
+    sort_cell_index.resize(npart);
+    sort_cell_start.assign(ncells+1, 0);
+    
+    // first loop computes the cell of each particle, counts the # of particles in each cell and the disorder
+    ndisorder = count_cells(nx, ny, nz, morton);
+    
+    // the bins remain sorted by sort_part in between full sorts
+    if ( npart==0 || ndisorder < sort_threshold*npart ) return false;
+    
+    // second loop converts the count array in cumulative sum
+    for (icell=0; icell < ncells; icell++)
+        sort_cell_start[icell+1] += sort_cell_start[icell];
+    
+    // Rebracketting : bin ibin holds the cells from ibin*clrw to (ibin+1)*clrw in x
+    for (unsigned int ibin=0; ibin < bmin.size(); ibin++) {
+        bmin[ibin] = sort_cell_start[ min( ibin   *clrw, nx)*ny*nz ];
+        bmax[ibin] = sort_cell_start[ min((ibin+1)*clrw, nx)*ny*nz ];
+    }
+    
+    // last loop gives its new index to each particle and updates the count array
     for (ip=0; ip < npart; ip++)
-        {
-            x = particles->position(0,ip)-min_loc;
-            y = particles->position(1,ip)-min_loc_vec[1];
-
-            ix = floor(x * dx_inv_) ;
-            iy = floor(y * dy_inv_) ;
-
-            ixy = iy + ix*params.n_space[1];
-
-
-            indices[ixy] ++;
-        }
-
-    // second loop convert the count array in cumulative sum
-    tot=0;
-    for (unsigned int ixy=0; ixy < nxy; ixy++)
-        {
-            oc = indices[ixy];
-            indices[ixy] = tot;
-            tot += oc;
-        }
+        sort_cell_index[ip] = sort_cell_start[ sort_cell_index[ip] ]++;
+    
+    particles_sorted[token].initialize(npart, *particles);
+    if (npart>0)
+        particles->overwrite_part(particles_sorted[token], sort_cell_index.data());
+    
+    particles = &particles_sorted[token] ;
+    
+    return true;
+}
 
-    //Bookmarking is not needed if normal sort is called before.
-    //bmin[0] = 0;    
-    //for (bin=0; bin<bmin.size()-1; bin++) { //Loop on the bins. 
-    //
-    //    bmin[bin+1] = indices[(bin+1)*params.n_space[1]*clrw] ;   
-    //    bmax[bin] = bmin[bin+1];   
-    //}
-    //bin = bmin.size()-1 ;
-    //bmax[bin] = npart;   
-
-    // last loop puts the particles and update the count array
+unsigned int Species::count_cells(unsigned int nx, unsigned int ny, unsigned int nz, bool morton)
+{
+    unsigned int ip, icell, previous_cell, ndisorder;
+    int ix, iy, iz;
+    unsigned int npart = particles->size();
+    unsigned int ncells_bin = clrw*ny*nz;
+    
+    const double* x = particles->Position[0].data<double>();
+    const double* y = (nDim_particle>1) ? particles->Position[1].data<double>() : NULL;
+    const double* z = (nDim_particle>2) ? particles->Position[2].data<double>() : NULL;
+    
+    previous_cell = 0;
+    ndisorder = 0;
+    iy = 0;
+    iz = 0;
     for (ip=0; ip < npart; ip++) {
-        x = particles->position(0,ip)-min_loc;
-        y = particles->position(1,ip)-min_loc_vec[1];
-
-        ix = floor(x * dx_inv_) ;
-        iy = floor(y * dy_inv_) ;
-
-        ixy = iy + ix*params.n_space[1];
-
-        particles->overwrite_part(ip, particles_sorted[token] , indices[ixy]);
-        indices[ixy]++;
+        ix = floor( (x[ip]-min_loc) * dx_inv_ );
+        ix = min( max(ix,0), (int)nx-1 );
+        if (nDim_particle>1) {
+            iy = floor( (y[ip]-min_loc_vec[1]) * dy_inv_ );
+            iy = min( max(iy,0), (int)ny-1 );
+            if (nDim_particle>2) {
+                iz = floor( (z[ip]-min_loc_vec[2]) * dz_inv_ );
+                iz = min( max(iz,0), (int)nz-1 );
+            }
+        }
+        if (morton)
+            icell = (ix/clrw)*ncells_bin + sort_cell_rank[ ((ix%clrw)*ny + iy)*nz + iz ];
+        else
+            icell = (ix*ny + iy)*nz + iz;
+        sort_cell_index[ip] = icell;
+        sort_cell_start[icell+1]++;
+        if (icell < previous_cell) ndisorder++;
+        previous_cell = icell;
     }
+    
+    return ndisorder;
+}
 
-    particles = &particles_sorted[token] ;
-
+// ---------------------------------------------------------------------------------------------------------------------
+// Rank of each cell of a bin (nx*ny*nz cells, z varying fastest) along the Z-order curve, which interleaves the bits
+// of the x, y and z indices : consecutive cells, hence consecutive particles, then remain close in all directions
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::computeMortonRank(unsigned int nx, unsigned int ny, unsigned int nz)
+{
+    unsigned int ncells = nx*ny*nz;
+    vector<pair<uint64_t, unsigned int> > code(ncells);
+    unsigned int icell = 0;
+    for (unsigned int ix=0; ix<nx; ix++)
+        for (unsigned int iy=0; iy<ny; iy++)
+            for (unsigned int iz=0; iz<nz; iz++) {
+                uint64_t c = 0;
+                for (unsigned int bit=0; bit<21; bit++)
+                    c |= ( (uint64_t)((ix>>bit)&1) << (3*bit+2) )
+                       | ( (uint64_t)((iy>>bit)&1) << (3*bit+1) )
+                       | ( (uint64_t)((iz>>bit)&1) << (3*bit  ) );
+                code[icell] = make_pair(c, icell);
+                icell++;
+            }
+    sort( code.begin(), code.end() );
+    
+    sort_cell_rank.resize(ncells);
+    for (unsigned int irank=0; irank<ncells; irank++)
+        sort_cell_rank[ code[irank].second ] = irank;
 }
 
 
@@ -854,13 +1070,11 @@ int Species::createParticles(vector<unsigned int> n_space_to_create, Params& par
     delete [] temp;
     delete [] vel;
     
-    // Recalculate former position using the particle velocity
-    // (necessary to calculate currents at time t=0 using the Esirkepov projection scheme)
+    // Energy of the particles injected by the moving window
+    // (no former position to recompute: the Esirkepov projection uses the old cell index
+    //  and offset buffered by the interpolator in smpi->dynamics_iold/dynamics_deltaold)
     if (patch->isXmax()) {
         for (unsigned int iPart=n_existing_particles; iPart<n_existing_particles+npart_effective; iPart++) {
-            /*897 for (int i=0; i<(int)nDim_particle; i++) {
-              particles->position_old(i,iPart) -= particles->momentum(i,iPart)/particles->lor_fac(iPart) * params.timestep;
-              }897*/
             nrj_new_particles += particles->weight(iPart)*(particles->lor_fac(iPart)-1.0);
         }
     }
@@ -876,25 +1090,45 @@ int Species::createParticles(vector<unsigned int> n_space_to_create, Params& par
 // Move all particles from another species to this one
 void Species::importParticles( Params& params, Patch* patch, Particles& source_particles, vector<Diagnostic*>& localDiags )
 {
-    unsigned int npart = source_particles.size(), ibin, ii, nbin=bmin.size();
+    unsigned int npart = source_particles.size(), nbin=bmin.size();
+    if( npart==0 ) return;
     double inv_cell_length = 1./ params.cell_length[0];
     
     // If this species is tracked, set the particle IDs
     if( particles->tracked )
         dynamic_cast<DiagnosticTrack*>(localDiags[tracking_diagnostic])->setIDs( source_particles );
     
-    // Move particles
+    // Count the particles arriving in each bin
+    vector<unsigned int> target_bin( npart );
+    vector<int> shift( nbin+1, 0 ); // shift[ibin] : number of particles arriving in the bins before ibin
     for( unsigned int i=0; i<npart; i++ ) {
-        // Copy particle to the correct bin
-        ibin = source_particles.position(0,i)*inv_cell_length - ( patch->getCellStartingGlobalIndex(0) + params.oversize[0] );
+        unsigned int ibin = source_particles.position(0,i)*inv_cell_length - ( patch->getCellStartingGlobalIndex(0) + params.oversize[0] );
         ibin /= params.clrw;
-        source_particles.cp_particle(i, *particles, bmin[ibin] );
-        // Update the bin counts
+        target_bin[i] = ibin;
+        shift[ibin+1]++;
+    }
+    for( unsigned int ibin=1; ibin<=nbin; ibin++ )
+        shift[ibin] += shift[ibin-1];
+    
+    // Make room at the end of each bin, moving the bins once, from the last one
+    int n_trail = particles->size() - bmax[nbin-1];
+    particles->create_particles( npart );
+    if( n_trail > 0 )
+        particles->overwrite_part( bmax[nbin-1], bmax[nbin-1]+max(n_trail,(int)npart), min(n_trail,(int)npart) );
+    for( int ibin=nbin-1; ibin>=1; ibin-- ) {
+        int n_particles = bmax[ibin]-bmin[ibin];
+        int nmove = min( n_particles, shift[ibin] ); // Number of particles to move
+        int lmove = max( n_particles, shift[ibin] ); // How far they must be moved
+        if( nmove>0 ) particles->overwrite_part( bmin[ibin], bmin[ibin]+lmove, nmove );
+        bmin[ibin] += shift[ibin];
+        bmax[ibin] += shift[ibin];
+    }
+    
+    // Copy each particle at the end of its bin
+    for( unsigned int i=0; i<npart; i++ ) {
+        unsigned int ibin = target_bin[i];
+        source_particles.overwrite_part( i, *particles, bmax[ibin] );
         bmax[ibin]++;
-        for (ii=ibin+1; ii<nbin; ii++) {
-            bmin[ii]++;
-            bmax[ii]++;
-        }
     }
     
     source_particles.clear();
@@ -20,6 +20,8 @@ class Interpolator;
 class Projector;
 class PartBoundCond;
 class PartWalls;
+class Merging;
+class Resampling;
 class Field3D;
 class Patch;
 class SimWindow;
@@ -93,6 +95,31 @@ public:
     //! Ionization model per Specie (tunnel)
     std::string ionization_model;
     
+    //! Merging method per Specie ("none" or "vranic")
+    std::string merging_method;
+    //! Number of timesteps between two merging operations
+    unsigned int merge_every;
+    //! Cells containing less particles than this are not merged
+    unsigned int merge_min_particles_per_cell;
+    //! Number of sub-cells in momentum space (x,y,z) used to group the particles to merge
+    std::vector<unsigned int> merge_momentum_cells;
+    
+    //! Number of timesteps between two resampling operations
+    unsigned int resampling_every;
+    //! Cells containing more than resampling_ceiling times the target are merged
+    double resampling_ceiling;
+    
+    //! Sorting of the particles ("bin": only among the clrw-wide bins, "cell" or "morton": by cell, with count_sort_part)
+    std::string sort_mode;
+    //! Fraction of particles out of their cell order above which the particles are sorted by cell (see count_sort_part)
+    double sort_threshold;
+    
+    //! The species is moved every subcycle timesteps only, with a timestep subcycle*dt
+    unsigned int subcycle;
+    
+    //! Precision of the momentum update in the pusher ("double", or "single" with the positions still advanced in double)
+    std::string push_precision;
+    
     //! Type of density profile ("nb" or "charge")
     std::string densityProfileType;
     
@@ -111,6 +138,9 @@ public:
     //! number-of-particle-per-cell profile
     Profile *ppcProfile;
     
+    //! target number-of-particle-per-cell profile for the resampling
+    Profile *resamplingProfile;
+    
     
     //! Method returning the Particle list for the considered Species
     inline Particles getParticlesList() const {
@@ -131,7 +161,7 @@ public:
     }
     
     //! Method calculating the Particle dynamics (interpolation, pusher, projection)
-    virtual void dynamics(double time, unsigned int ispec, ElectroMagn* EMfields, Interpolator* interp,
+    virtual void dynamics(double time, int itime, unsigned int ispec, ElectroMagn* EMfields, Interpolator* interp,
                           Projector* proj, Params &params, bool diag_flag,
                           PartWalls* partWalls, Patch* patch, SmileiMPI* smpi, std::vector<Diagnostic*>& localDiags);
     
@@ -150,12 +180,32 @@ public:
     //! Method used to initialize the Particle charge
     void initCharge(unsigned int, unsigned int, double);
     
+    
+    //! Apply the boundary conditions to the particles istart to iend-1, with nDim dimensions known at compile time
+    //! The particles leaving the patch are added to the exchange list, the energy they take away to nrj_lost
+    template<int nDim> void applyBoundaryConditions(int istart, int iend, double &nrj_lost);
+    //! applyBoundaryConditions instantiated for the dimension of the particles, chosen at the creation of the species
+    //! Only the boundary conditions are templated here: Interp, Push and Proj are already classes specialised for
+    //! the dimension, the order and the pusher by their factories, and are called once per chunk of particles
+    void (Species::*boundaryConditions)(int istart, int iend, double &nrj_lost);
+    
+    //! Extent [lo,hi] in each dimension which contains the particles istart to iend-1 of bin ibin, before and after
+    //! a push of the given maximum displacement: the bin slab along x, the box of the pushed particles along y and z
+    void chunkExtent(unsigned int ibin, int istart, int iend, double displacement, double *lo, double *hi);
+    
     //! Maximum charge at initialization
     double max_charge;
     
-    //! Method used to sort particles
+    //! Method used to merge particles (every merge_every timesteps)
+    void mergeParticles(int itime);
+    
+    //! Method used to split and merge particles towards the target resamplingProfile (every resampling_every timesteps)
+    void resampleParticles(int itime, Params& params, Patch* patch, std::vector<Diagnostic*>& localDiags);
+    
+    //! Method used to sort particles among the bins
     void sort_part();
-    void count_sort_part(Params& param);
+    //! Method used to sort particles by cell (out-of-place, into the other particles_sorted buffer), if disordered enough
+    bool count_sort_part(Params& param);
     
     void updateMvWinLimits(double x_moved);
     
@@ -167,6 +217,12 @@ public:
     //! Ionization method
     Ionization* Ionize;
     
+    //! Merging method
+    Merging* Merge;
+    
+    //! Resampling method
+    Resampling* Resample;
+    
     //! Pointer to the species where field-ionized electrons go
     Species *electron_species;
     //! Index of the species where field-ionized electrons go
@@ -176,6 +232,8 @@ public:
     
     //! Cluster width in number of cells
     unsigned int clrw; //Should divide the number of cells in X of a single MPI domain. 
+    //! Number of particles of a bin interpolated, pushed and projected together (0 : the whole bin)
+    unsigned int chunk_size;
     //! first and last index of each particle bin
     std::vector<int> bmin, bmax;
     //! sub dimensions of buffers for dim > 1
@@ -236,10 +294,7 @@ public:
         if ( particles->isTest )
             speciesSize += sizeof ( unsigned int );*/
         //speciesSize *= getNbrOfParticles();
-        int speciesSize(0);
-        speciesSize += particles->double_prop.size()*sizeof(double);
-        speciesSize += particles->short_prop.size()*sizeof(short);
-        speciesSize += particles->uint64_prop.size()*sizeof(uint64_t);
+        int speciesSize = particles->bytes_per_particle();
         speciesSize *= getParticlesCapacity();
         return speciesSize;
     }
@@ -302,6 +357,23 @@ private:
     //! Accumulate nrj added with new particles
     double nrj_new_particles;
     
+    //! Remove the particles of remove_list from bin ibin (holes are filled with the last particles of the bin)
+    void removeParticlesFromBin(unsigned int ibin, std::vector<int>& remove_list);
+    //! Remove the gaps between the bins
+    void packBins();
+    
+    //! Cell, then new index, of each particle (count_sort_part)
+    std::vector<unsigned int> sort_cell_index;
+    //! Index of the first particle of each cell (count_sort_part)
+    std::vector<unsigned int> sort_cell_start;
+    //! Rank of each cell of a bin along the Z-order curve (sort_mode="morton")
+    std::vector<unsigned int> sort_cell_rank;
+    //! Compute sort_cell_rank for bins of nx*ny*nz cells
+    void computeMortonRank(unsigned int nx, unsigned int ny, unsigned int nz);
+    //! Cell of each particle and count of particles per cell (count_sort_part).
+    //! Returns the number of particles found before a particle of a lower cell
+    unsigned int count_cells(unsigned int nx, unsigned int ny, unsigned int nz, bool morton);
+    
     //! Samples npoints values of energies in a Maxwell-Juttner distribution
     std::vector<double> maxwellJuttner(unsigned int npoints, double temperature);
     //! Array used in the Maxwell-Juttner sampling (see doc)
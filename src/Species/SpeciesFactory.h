@@ -1,6 +1,8 @@
 #ifndef SPECIESFACTORY_H
 #define SPECIESFACTORY_H
 
+#include <algorithm>
+
 #include "Species.h"
 #include "Species_norm.h"
 #include "Species_rrll.h"
@@ -255,6 +257,83 @@ public:
         TimeSelection track_timeSelection( PyTools::extract_py("track_every", "Species", ispec), "Track" );
         thisSpecies->particles->tracked = ! track_timeSelection.isEmpty();
         
+        // Find out whether particles are stored in single precision
+        std::string precision("double");
+        PyTools::extract("precision", precision, "Species", ispec);
+        if (precision=="single") {
+            if (thisSpecies->dynamics_type!="norm" && thisSpecies->dynamics_type!="borisnr")
+                ERROR("For species '" << species_type << "' precision='single' requires dynamics_type='norm' or 'borisnr'");
+            thisSpecies->particles->singlePrecision = true;
+        } else if (precision!="double") {
+            ERROR("For species '" << species_type << "' unknown precision: " << precision);
+        }
+        
+        // Find out whether the pusher computes the momentum in single precision
+        PyTools::extract("push_precision", thisSpecies->push_precision, "Species", ispec);
+        if (thisSpecies->push_precision=="single") {
+            if (thisSpecies->dynamics_type!="norm" && thisSpecies->dynamics_type!="vay" && thisSpecies->dynamics_type!="higueracary")
+                ERROR("For species '" << species_type << "' push_precision='single' requires dynamics_type='norm', 'vay' or 'higueracary'");
+        } else if (thisSpecies->push_precision!="double") {
+            ERROR("For species '" << species_type << "' unknown push_precision: " << thisSpecies->push_precision);
+        }
+        
+        // Find out how particles are sorted
+        PyTools::extract("sort_mode", thisSpecies->sort_mode, "Species", ispec);
+        if (thisSpecies->sort_mode!="bin" && thisSpecies->sort_mode!="cell" && thisSpecies->sort_mode!="morton") {
+            ERROR("For species '" << species_type << "' unknown sort_mode: " << thisSpecies->sort_mode);
+        }
+        PyTools::extract("sort_threshold", thisSpecies->sort_threshold, "Species", ispec);
+        if (thisSpecies->sort_threshold<0. || thisSpecies->sort_threshold>1.) {
+            ERROR("For species '" << species_type << "', sort_threshold must be between 0 and 1");
+        }
+        
+        // Find out whether the species is subcycled
+        PyTools::extract("subcycle", thisSpecies->subcycle, "Species", ispec);
+        if (thisSpecies->subcycle==0)
+            ERROR("For species '" << species_type << "' subcycle must be > 0");
+        if (thisSpecies->subcycle>1 && thisSpecies->ionization_model!="none")
+            ERROR("For species '" << species_type << "' subcycle > 1 is incompatible with ionization");
+        // The particles (slower than light) must move less than one cell per move
+        if (thisSpecies->subcycle>1) {
+            double min_cell_length = *std::min_element( params.cell_length.begin(), params.cell_length.begin()+params.nDim_field );
+            if (thisSpecies->subcycle*params.timestep >= min_cell_length)
+                ERROR("For species '" << species_type << "' subcycle*timestep must be smaller than the smallest cell_length (" << min_cell_length << ")");
+        }
+        
+        // Manage the merging parameters
+        PyTools::extract("merging_method", thisSpecies->merging_method, "Species", ispec);
+        if (thisSpecies->merging_method!="none") {
+            if (thisSpecies->particles->isTest)
+                ERROR("For species '" << species_type << "' test particles cannot be merged");
+            if (thisSpecies->particles->tracked)
+                ERROR("For species '" << species_type << "' tracked particles cannot be merged");
+            PyTools::extract("merge_every", thisSpecies->merge_every, "Species", ispec);
+            if (thisSpecies->merge_every==0)
+                ERROR("For species '" << species_type << "' merge_every must be > 0");
+            PyTools::extract("merge_min_particles_per_cell", thisSpecies->merge_min_particles_per_cell, "Species", ispec);
+        }
+        PyTools::extract("merge_momentum_cells", thisSpecies->merge_momentum_cells, "Species", ispec);
+        if (thisSpecies->merge_momentum_cells.size()!=3)
+            ERROR("For species '" << species_type << "' merge_momentum_cells must have 3 elements");
+        for (unsigned int i=0; i<3; i++)
+            if (thisSpecies->merge_momentum_cells[i]==0)
+                ERROR("For species '" << species_type << "' merge_momentum_cells must be > 0");
+        
+        // Manage the resampling parameters
+        if( PyTools::extract_pyProfile("resampling_ppc", profile1, "Species", ispec) ) {
+            if (thisSpecies->particles->isTest)
+                ERROR("For species '" << species_type << "' test particles cannot be resampled");
+            if (thisSpecies->particles->tracked)
+                ERROR("For species '" << species_type << "' tracked particles cannot be resampled");
+            PyTools::extract("resampling_every", thisSpecies->resampling_every, "Species", ispec);
+            if (thisSpecies->resampling_every==0)
+                ERROR("For species '" << species_type << "' resampling_every must be > 0");
+            PyTools::extract("resampling_ceiling", thisSpecies->resampling_ceiling, "Species", ispec);
+            if (thisSpecies->resampling_ceiling<=1.)
+                ERROR("For species '" << species_type << "' resampling_ceiling must be > 1");
+            thisSpecies->resamplingProfile = new Profile(profile1, params.nDim_particle, "resampling_ppc "+species_type, true);
+        }
+        
         // Create the particles
         if (!params.restart) {
             // does a loop over all cells in the simulation
@@ -306,6 +385,18 @@ public:
         newSpecies->thermalMomentum       = species->thermalMomentum;
         newSpecies->atomic_number         = species->atomic_number;
         newSpecies->ionization_model      = species->ionization_model;
+        newSpecies->merging_method        = species->merging_method;
+        newSpecies->merge_every           = species->merge_every;
+        newSpecies->merge_min_particles_per_cell = species->merge_min_particles_per_cell;
+        newSpecies->merge_momentum_cells  = species->merge_momentum_cells;
+        newSpecies->resampling_every      = species->resampling_every;
+        newSpecies->resampling_ceiling    = species->resampling_ceiling;
+        newSpecies->sort_mode             = species->sort_mode;
+        newSpecies->sort_threshold        = species->sort_threshold;
+        newSpecies->subcycle              = species->subcycle;
+        newSpecies->push_precision        = species->push_precision;
+        if (species->resamplingProfile)
+            newSpecies->resamplingProfile = new Profile(species->resamplingProfile);
         newSpecies->densityProfileType    = species->densityProfileType;
         newSpecies->densityProfile        = new Profile(species->densityProfile);
         newSpecies->ppcProfile            = new Profile(species->ppcProfile);
@@ -323,6 +414,7 @@ public:
         
         newSpecies->particles->isTest              = species->particles->isTest;
         newSpecies->particles->tracked             = species->particles->tracked;
+        newSpecies->particles->singlePrecision     = species->particles->singlePrecision;
         
         // \todo : NOT SURE HOW THIS BEHAVES WITH RESTART
         if ( (!params.restart) && (with_particles) ) {
@@ -367,8 +459,8 @@ public:
                         ERROR("For species '"<<retSpecies[ispec1]->species_type<<"' ionization_electrons must be a species with mass==1");
                     retSpecies[ispec1]->electron_species_index = ispec2;
                     retSpecies[ispec1]->electron_species = retSpecies[ispec2];
-                    retSpecies[ispec1]->Ionize->new_electrons.tracked = retSpecies[ispec1]->electron_species->particles->tracked;
-                    retSpecies[ispec1]->Ionize->new_electrons.initialize(0, params.nDim_particle );
+                    // New electrons are stored like the electron species
+                    retSpecies[ispec1]->Ionize->new_electrons.initialize(0, *retSpecies[ispec1]->electron_species->particles );
                     if ( ( !retSpecies[ispec1]->getNbrOfParticles() ) && ( !retSpecies[ispec2]->getNbrOfParticles() ) ) {
                         int max_eon_number = retSpecies[ispec1]->getNbrOfParticles() * retSpecies[ispec1]->atomic_number;
                         retSpecies[ispec2]->particles->reserve( max_eon_number, retSpecies[ispec2]->particles->dimension() );
@@ -396,8 +488,7 @@ public:
             if (retSpecies[i]->Ionize) {
                 retSpecies[i]->electron_species_index = vecSpecies[i]->electron_species_index;
                 retSpecies[i]->electron_species = retSpecies[retSpecies[i]->electron_species_index];
-                retSpecies[i]->Ionize->new_electrons.tracked = retSpecies[i]->electron_species->particles->tracked;
-                retSpecies[i]->Ionize->new_electrons.initialize(0, params.nDim_particle );
+                retSpecies[i]->Ionize->new_electrons.initialize(0, *retSpecies[i]->electron_species->particles );
             }
         }
         
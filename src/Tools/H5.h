@@ -319,6 +319,25 @@ class H5 {
         H5Dclose(did);
     }
     
+    //! template to read a generic 1d array of known size (already allocated)
+    template<class T>
+    static void getArray(hid_t locationId, std::string vect_name, T* array, unsigned int size, hid_t type) {
+        hid_t did = H5Dopen(locationId, vect_name.c_str(), H5P_DEFAULT);
+        hid_t sid = H5Dget_space(did);
+        int sdim = H5Sget_simple_extent_ndims(sid);
+        if (sdim!=1) {
+            ERROR("Reading vector " << vect_name << " is not 1D but " <<sdim << "D");
+        }
+        hsize_t dim[1];
+        H5Sget_simple_extent_dims(sid,dim,NULL);
+        if (dim[0] != size) {
+            ERROR("Reading vector " << vect_name << " mismatch " << size << " != " << dim[0]);
+        }
+        H5Sclose(sid);
+        H5Dread(did, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, array);
+        H5Dclose(did);
+    }
+    
 };
 
 #endif
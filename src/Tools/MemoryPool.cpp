@@ -0,0 +1,54 @@
+#include "MemoryPool.h"
+
+#include <cstdlib>
+
+#include "Tools.h"
+
+using namespace std;
+
+thread_local MemoryPool::Pool MemoryPool::pool_;
+
+MemoryPool::Pool::~Pool()
+{
+    for ( multimap<size_t, void*>::iterator it=blocks.begin() ; it!=blocks.end() ; it++ )
+        free( it->second );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Smallest block of the pool able to hold size bytes, if it does not waste more than half the request. Otherwise, a
+// new block is allocated.
+// ---------------------------------------------------------------------------------------------------------------------
+void* MemoryPool::allocate( size_t& size )
+{
+    if ( size == 0 ) return NULL;
+    
+    multimap<size_t, void*>::iterator it = pool_.blocks.lower_bound( size );
+    if ( it != pool_.blocks.end() && it->first <= size + size/2 ) {
+        void* ptr = it->second;
+        size = it->first;
+        pool_.blocks.erase( it );
+        return ptr;
+    }
+    
+    void* ptr;
+    if ( posix_memalign( &ptr, alignment, size ) != 0 )
+        ERROR( "Cannot allocate " << size << " bytes" );
+    return ptr;
+}
+
+void MemoryPool::release( void* ptr, size_t size )
+{
+    if ( !ptr ) return;
+    
+    if ( pool_.retaining )
+        pool_.blocks.insert( make_pair( size, ptr ) );
+    else
+        free( ptr );
+}
+
+void MemoryPool::trim()
+{
+    for ( multimap<size_t, void*>::iterator it=pool_.blocks.begin() ; it!=pool_.blocks.end() ; it++ )
+        free( it->second );
+    pool_.blocks.clear();
+}
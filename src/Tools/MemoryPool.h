@@ -0,0 +1,46 @@
+#ifndef MEMORYPOOL_H
+#define MEMORYPOOL_H
+
+#include <cstddef>
+#include <map>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class MemoryPool : pool of the large blocks (field data, particle arenas) released by the patches which leave the
+//! moving window, recycled by the patches which enter it.
+//! Each thread has its own pool. Blocks released while the pool retains are kept in the pool of the calling thread,
+//! and are given back by allocate to the same thread. Otherwise, blocks are simply freed.
+//  --------------------------------------------------------------------------------------------------------------------
+class MemoryPool {
+public:
+    //! Allocate a block of at least size bytes, aligned on alignment bytes, taken from the pool when possible.
+    //! size is set to the actual size of the block.
+    static void* allocate( size_t& size );
+    
+    //! Release a block given by allocate : kept in the pool while retaining, freed otherwise
+    static void release( void* ptr, size_t size );
+    
+    //! Start / stop keeping the released blocks in the pool of the calling thread
+    static inline void startRetaining() { pool_.retaining = true;  }
+    static inline void stopRetaining()  { pool_.retaining = false; }
+    
+    //! Free all the blocks of the pool of the calling thread
+    static void trim();
+    
+    //! Alignment (in bytes) of the blocks
+    static const size_t alignment = 64;
+    
+private:
+    struct Pool {
+        Pool() : retaining(false) {}
+        ~Pool();
+        //! Free blocks, sorted by size
+        std::multimap<size_t, void*> blocks;
+        //! True if released blocks are kept
+        bool retaining;
+    };
+    
+    //! Pool of the calling thread
+    static thread_local Pool pool_;
+};
+
+#endif
@@ -50,6 +50,23 @@ void Timer::restart()
     }
 }
 
+void Timer::restartNoBarrier()
+{
+    #pragma omp master
+    {
+        last_start_ = MPI_Wtime();
+    }
+}
+
+void Timer::updateNoBarrier()
+{
+    #pragma omp master
+    {
+        time_acc_ +=  MPI_Wtime()-last_start_;
+        last_start_ = MPI_Wtime();
+    }
+}
+
 void Timer::reboot()
 {
     smpi_->barrier();
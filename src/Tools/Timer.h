@@ -21,6 +21,10 @@ public:
     void update(bool store = false);
     //! Start a new cumulative period
     void restart();
+    //! Same as restart and update, without OpenMP barrier : for a section already delimited by the implicit barriers
+    //! of omp for loops, timed by the master thread
+    void restartNoBarrier();
+    void updateNoBarrier();
     //! Start a new cumulative period
     void reboot();
     //! Return accumulated time
@@ -4,6 +4,7 @@
 #include "Timers.h"
 
 #include "SmileiMPI.h"
+#include "Species.h"
 #include "Tools.h"
 
 using namespace std;
@@ -42,6 +43,17 @@ Timers::~Timers()
 {
 }
 
+void Timers::initSort(std::vector<Species*>& vecSpecies, SmileiMPI * smpi)
+{
+    sort.clear();
+    for (unsigned int ispec=0 ; ispec<vecSpecies.size() ; ispec++)
+        sort.push_back( Timer("Sort "+vecSpecies[ispec]->species_type) );
+    sort_count.assign( vecSpecies.size(), 0 );
+    
+    for( unsigned int i=0; i<sort.size(); i++)
+        sort[i].init(smpi);
+}
+
 void Timers::profile(SmileiMPI * smpi)
 {
     std::vector<Timer*> avg_timers = consolidate(smpi);
@@ -55,6 +67,22 @@ void Timers::profile(SmileiMPI * smpi)
         
         for (unsigned int i=0 ; i<avg_timers.size() ; i++)
             avg_timers[i]->print(global.getTime());
+    }
+    
+    // Sort timers are included in syncPart : printed apart, with the number of sorts by cell (summed on all patches)
+    if ( smpi->isMaster() && sort.size()>0 )
+        MESSAGE(0, "\t Including (in Sync Particles) :");
+    for (unsigned int ispec=0 ; ispec<sort.size() ; ispec++) {
+        double sort_time(0.);
+        unsigned int count(0);
+        MPI_Reduce( &(sort[ispec].time_acc_), &sort_time, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+        MPI_Reduce( &(sort_count[ispec]), &count, 1, MPI_UNSIGNED, MPI_SUM, 0, MPI_COMM_WORLD );
+        if ( smpi->isMaster() && sort_time>0. ) {
+            MESSAGE(0, "\t" << setw(14) << sort[ispec].name() << "\t" << sort_time/smpi->getSize() << "\t" << count << " sorts by cell" );
+        }
+    }
+    
+    if ( smpi->isMaster() ) {
         MESSAGE(0, "\n\t Printed times are averaged per MPI process" );
         MESSAGE(0, "\t\t See advanced metrics in profil.txt");
     }
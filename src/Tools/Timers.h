@@ -7,6 +7,7 @@
 #include "Timer.h"
 
 class SmileiMPI;
+class Species;
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class Timers
@@ -29,6 +30,13 @@ public:
     Timer syncPart  ;
     Timer syncField ;
     Timer syncDens  ;
+    
+    //! Time spent sorting each species (within syncPart), and number of sorts by cell (sort_mode="cell" or "morton")
+    std::vector<Timer> sort;
+    std::vector<unsigned int> sort_count;
+    
+    //! Create the sort timers, once the species are known
+    void initSort(std::vector<Species*>& vecSpecies, SmileiMPI * smpi);
 
     void profile(SmileiMPI * smpi);
     std::vector<Timer*> consolidate(SmileiMPI * smpi);
@@ -6,6 +6,10 @@
 #include <fcntl.h>
 #include <iomanip>
 #include <unistd.h>
+#include <stdint.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 
 void Tools::printMemFootPrint(std::string tag) {
 
@@ -38,3 +42,41 @@ void Tools::printMemFootPrint(std::string tag) {
 
 }
 
+
+// NUMA node of the core running the calling thread, from the getcpu system call
+int Tools::numaNodeOfThread() {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned int cpu, node;
+    if ( syscall( SYS_getcpu, &cpu, &node, NULL ) == 0 )
+        return node;
+#endif
+    return -1;
+}
+
+// NUMA node of each memory page of [start, start+size), from the move_pages system call used as a query
+// (no target nodes given : nothing is moved, the current node of each page is returned in status)
+void Tools::countPagesPerNumaNode(const void* start, size_t size, std::vector<unsigned int>& pages) {
+#if defined(__linux__) && defined(SYS_move_pages)
+    if ( !start || size==0 ) return;
+    
+    uintptr_t page_size = sysconf(_SC_PAGESIZE);
+    uintptr_t first = ( (uintptr_t)start / page_size ) * page_size;
+    uintptr_t last  = ( ((uintptr_t)start + size - 1) / page_size ) * page_size;
+    unsigned long npages = (last-first)/page_size + 1;
+    
+    std::vector<void*> address( npages );
+    std::vector<int>   status ( npages, -1 );
+    for ( unsigned long ipage=0 ; ipage<npages ; ipage++ )
+        address[ipage] = (void*)( first + ipage*page_size );
+    
+    if ( syscall( SYS_move_pages, 0, npages, &(address[0]), NULL, &(status[0]), 0 ) != 0 )
+        return;
+    
+    for ( unsigned long ipage=0 ; ipage<npages ; ipage++ ) {
+        if ( status[ipage] < 0 ) continue; // page not allocated yet
+        if ( (unsigned int)status[ipage] >= pages.size() )
+            pages.resize( status[ipage]+1, 0 );
+        pages[status[ipage]]++;
+    }
+#endif
+}
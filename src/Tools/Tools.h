@@ -26,6 +26,7 @@
 #include <cstdlib>
 
 #include <iostream>
+#include <vector>
 
 #include <mpi.h>
 
@@ -103,6 +104,11 @@ if (__i==__rk) {std::cout << "Proc [" << __i << "] " <<__txt << std::endl;} MPI_
 class Tools {
  public:
   static void printMemFootPrint(std::string tag);
+  
+  //! NUMA node of the core running the calling thread (-1 if unknown)
+  static int numaNodeOfThread();
+  //! Add the number of memory pages of [start, start+size) located on each NUMA node to pages (unchanged if unknown)
+  static void countPagesPerNumaNode(const void* start, size_t size, std::vector<unsigned int>& pages);
 };
 
 
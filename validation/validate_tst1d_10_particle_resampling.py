@@ -0,0 +1,17 @@
+import os, re, numpy as np
+from Smilei import *
+
+S = Smilei(".", verbose=False)
+
+# The fields are frozen : the resampling alone changes the particles
+Ntot = np.array(S.Scalar("Ntot_eon").getData())
+Dens = np.array(S.Scalar("Dens_eon").getData())
+Ukin = np.array(S.Scalar("Ukin_eon").getData())
+
+# Number of particles relative to the target (32 particles in each of the 256 cells), after each resampling
+# (the initial distribution is random : two runs differ by up to ~7% of the target)
+Validate("Number of particles relative to the target", Ntot/(32.*256.), 0.15)
+
+# Relative variation of the total weight (i.e. charge) and kinetic energy (split particles keep the momentum, with half weight)
+Validate("Charge conservation", np.abs(Dens/Dens[0]-1.).max(), 1e-8)
+Validate("Energy conservation", np.abs(Ukin/Ukin[0]-1.).max(), 1e-8)
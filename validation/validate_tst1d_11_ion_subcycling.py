@@ -0,0 +1,21 @@
+import os, re, numpy as np
+from Smilei import *
+
+S = Smilei(".", verbose=False)
+
+dx = S.namelist.Main.cell_length[0]
+
+# Trajectories of the test ions, moved at each timestep or subcycled
+ref = S.TrackParticles("ion_ref", axes=["x","px"]).get()
+sub = S.TrackParticles("ion_sub", axes=["x","px"]).get()
+
+# Difference of positions (in cells) and of momenta (relative to the largest momentum)
+x_error  = np.abs(np.array(sub["x"]) - np.array(ref["x"])).max() / dx
+px_error = np.abs(np.array(sub["px"]) - np.array(ref["px"])).max() / np.abs(np.array(ref["px"])).max()
+
+Validate("Subcycled ion position difference", x_error, 1e-5)
+Validate("Subcycled ion momentum difference", px_error, 1e-4)
+
+# Largest displacement of the ions moved at each timestep (in cells), set by the expansion of the plasma
+x_ref = np.array(ref["x"])
+Validate("Maximum ion displacement", np.abs(x_ref - x_ref[0]).max() / dx, 0.2)
@@ -0,0 +1,52 @@
+# ____________________________________________________________________________
+#
+# This script validates the particles stored with precision = "single" by comparing
+# the trajectory of a particle in a circular Gaussian plane wave to that
+# given by the same particle stored in double precision, and by checking
+# the displacement of slow protons located far from the origin.
+#
+# _____________________________________________________________________________
+
+
+import os, re, numpy as np
+from Smilei import *
+
+S = Smilei(".", verbose=False)
+
+# Step represents the step between trajectory points what we consider
+step = 2
+
+# List of relativistic pushers
+pusher_list = ["norm"]
+
+def momenta(species):
+  Track = S.TrackParticles(species, axes=["px","py","pz"]).get()
+  px = np.array(Track['px'][::step,0])
+  py = np.array(Track['py'][::step,0])
+  pz = np.array(Track['pz'][::step,0])
+  return px, np.sqrt(py**2 + pz**2), np.sqrt(1. + px**2 + py**2 + pz**2)
+
+def displacement(species):
+  x = np.array(S.TrackParticles(species, axes=["x"]).get()['x'][::step,0])
+  return x - x[0]
+
+for pusher in pusher_list:
+  
+  px_d, p_perp_d, gamma_d = momenta("electron_" + pusher + "_double")
+  px_s, p_perp_s, gamma_s = momenta("electron_" + pusher + "_single")
+  
+  # Trajectories (the momenta are stored as floats in single precision)
+  Validate("Electron p_perp for pusher: " + pusher, p_perp_s, 1e-3 )
+  Validate("Electron p_x for pusher: " + pusher, px_s, 1e-3 )
+  Validate("Electron gamma for pusher: " + pusher, gamma_s, 1e-3 )
+  
+  # Largest differences to double precision, relative to the largest value in double precision
+  Validate("Electron p_perp difference for pusher: " + pusher, np.abs(p_perp_s-p_perp_d).max()/np.abs(p_perp_d).max(), 1e-4 )
+  Validate("Electron gamma difference for pusher: " + pusher, np.abs(gamma_s-gamma_d).max()/np.abs(gamma_d).max(), 1e-4 )
+
+# Slow protons : the displacement in one timestep (~1e-6) is smaller than the float resolution of x (~3e-5),
+# it must be kept by the positions, which are stored in double in both precisions
+dx_d = displacement("proton_slow_double")
+dx_s = displacement("proton_slow_single")
+Validate("Slow proton displacement", dx_s, 1e-7 )
+Validate("Slow proton displacement difference", np.abs(dx_s-dx_d).max()/np.abs(dx_d).max(), 1e-4 )
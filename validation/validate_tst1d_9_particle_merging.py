@@ -0,0 +1,16 @@
+import os, re, numpy as np
+from Smilei import *
+
+S = Smilei(".", verbose=False)
+
+# The fields are frozen : the merging alone changes the particles
+Ntot = np.array(S.Scalar("Ntot_eon").getData())
+Dens = np.array(S.Scalar("Dens_eon").getData())
+Ukin = np.array(S.Scalar("Ukin_eon").getData())
+
+# Fraction of the particles kept after each merging (the initial distribution is random)
+Validate("Fraction of particles kept by the merging", Ntot/Ntot[0], 0.05)
+
+# Relative variation of the total weight (i.e. charge) and kinetic energy (merged groups keep their weight and energy)
+Validate("Charge conservation", np.abs(Dens/Dens[0]-1.).max(), 1e-8)
+Validate("Energy conservation", np.abs(Ukin/Ukin[0]-1.).max(), 1e-8)
@@ -0,0 +1,18 @@
+import os, re, numpy as np
+from Smilei import *
+
+S = Smilei(".", verbose=False)
+
+# Scalars of each copy of the beams, compared to the copy sorted with sort_mode "bin"
+for name in ["cell", "cell_threshold", "morton"]:
+    for beam in ["eon1", "eon2"]:
+        Ntot     = np.array(S.Scalar("Ntot_"+beam+"_"+name).getData())
+        Ntot_bin = np.array(S.Scalar("Ntot_"+beam+"_bin" ).getData())
+        Validate("Number of particles "+beam+"_"+name, bool((Ntot==Ntot_bin).all()))
+        Ukin     = np.array(S.Scalar("Ukin_"+beam+"_"+name).getData())
+        Ukin_bin = np.array(S.Scalar("Ukin_"+beam+"_bin" ).getData())
+        Validate("Kinetic energy difference "+beam+"_"+name, np.abs(Ukin/Ukin_bin-1.).max(), 1e-10)
+
+# Kinetic energy of the beams sorted with sort_mode "bin" (two-stream growth)
+for beam in ["eon1", "eon2"]:
+    Validate("Kinetic energy "+beam+"_bin", S.Scalar("Ukin_"+beam+"_bin").getData(), 1e-9)